@@ -15,6 +15,9 @@
  * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
  */
 
+// DPF specific changes to Dear ImGui, must be defined before any of its headers are included
+#define IMGUI_DPF_BACKEND
+
 #include "DearImGui.hpp"
 #include "Application.hpp"
 
@@ -35,7 +38,6 @@
 #endif
 
 #ifndef IMGUI_SKIP_IMPLEMENTATION
-# define IMGUI_DPF_BACKEND
 # include "DearImGui/imgui.cpp"
 # include "DearImGui/imgui_demo.cpp"
 # include "DearImGui/imgui_draw.cpp"
@@ -81,23 +83,247 @@ static void SetClipboardTextFn(void* const userData, const char* const text)
     tlw->setClipboard(nullptr, text, std::strlen(text)+1);
 }
 
+// --------------------------------------------------------------------------------------------------------------------
+// process-wide registry of font atlases, shared between all ImGui widgets using the same font and pixel size
+// atlases no longer in use are kept around for a while, so that going back to a recent size does not rebuild them
+
+// number of unused font atlases to keep, least recently used ones are destroyed first
+static constexpr const uint kMaxUnusedFontAtlases = 4;
+
+struct SharedFontAtlas {
+    const void* fontData;
+    uint fontPixelSize;
+    uint refCount;
+    uint lastUse;
+    ImFontAtlas* atlas;
+};
+
+static ImVector<SharedFontAtlas> sSharedFontAtlases;
+static uint sSharedFontAtlasUseCounter = 0;
+
+#ifndef DGL_NO_SHARED_RESOURCES
+static inline uint getFontPixelSize(const float fontSize, const double scaleFactor) noexcept
+{
+    return d_roundToIntPositive(fontSize * scaleFactor);
+}
+#else
+static inline uint getFontPixelSize(float, double) noexcept
+{
+    // default ImGui font has a fixed size
+    return 0;
+}
+#endif
+
+// fontPixelSize already takes the scale factor into account, so widgets on different displays can still share atlases
+static ImFontAtlas* acquireSharedFontAtlas(const uint fontPixelSize)
+{
+   #ifndef DGL_NO_SHARED_RESOURCES
+    using namespace dpf_resources;
+    const void* const fontData = dejavusans_ttf;
+   #else
+    // default ImGui font, built on first use by the backend
+    const void* const fontData = nullptr;
+   #endif
+
+    for (SharedFontAtlas& shared : sSharedFontAtlases)
+    {
+        if (shared.fontData == fontData && shared.fontPixelSize == fontPixelSize)
+        {
+            ++shared.refCount;
+            shared.lastUse = ++sSharedFontAtlasUseCounter;
+            return shared.atlas;
+        }
+    }
+
+    ImFontAtlas* const atlas = IM_NEW(ImFontAtlas)();
+
+   #ifndef DGL_NO_SHARED_RESOURCES
+    // only rasterize glyphs once they are used, keeps startup fast with large glyph ranges
+    ImFontAtlasBuildSetDynamicGlyphs(atlas, true);
+
+    ImFontConfig fc;
+    fc.FontDataOwnedByAtlas = false;
+    fc.OversampleH = 1;
+    fc.OversampleV = 1;
+    fc.PixelSnapH = true;
+    atlas->AddFontFromMemoryTTF((void*)dejavusans_ttf, dejavusans_ttf_size, fontPixelSize, &fc);
+    atlas->Build();
+   #endif
+
+    const SharedFontAtlas shared = { fontData, fontPixelSize, 1, ++sSharedFontAtlasUseCounter, atlas };
+    sSharedFontAtlases.push_back(shared);
+    return atlas;
+}
+
+static void retainSharedFontAtlas(ImFontAtlas* const atlas)
+{
+    for (SharedFontAtlas& shared : sSharedFontAtlases)
+    {
+        if (shared.atlas == atlas)
+        {
+            ++shared.refCount;
+            return;
+        }
+    }
+
+    DISTRHO_SAFE_ASSERT(false);
+}
+
+// unused atlases are only kept while some widget is alive, so that nothing is left behind on plugin unload
+static void purgeUnusedFontAtlases()
+{
+    for (;;)
+    {
+        uint numUnused = 0;
+        SharedFontAtlas* oldest = nullptr;
+
+        for (SharedFontAtlas& shared : sSharedFontAtlases)
+        {
+            if (shared.refCount != 0)
+                continue;
+
+            ++numUnused;
+
+            if (oldest == nullptr || shared.lastUse < oldest->lastUse)
+                oldest = &shared;
+        }
+
+        if (numUnused == 0)
+            break;
+        if (numUnused <= kMaxUnusedFontAtlases && numUnused != static_cast<uint>(sSharedFontAtlases.size()))
+            break;
+
+        IM_DELETE(oldest->atlas);
+        sSharedFontAtlases.erase(oldest);
+    }
+
+    if (sSharedFontAtlases.empty())
+        sSharedFontAtlases.clear();
+}
+
+static void releaseSharedFontAtlas(ImFontAtlas* const atlas)
+{
+    for (SharedFontAtlas& shared : sSharedFontAtlases)
+    {
+        if (shared.atlas != atlas)
+            continue;
+
+        DISTRHO_SAFE_ASSERT_RETURN(shared.refCount != 0,);
+
+        if (--shared.refCount == 0)
+            purgeUnusedFontAtlases();
+        return;
+    }
+
+    DISTRHO_SAFE_ASSERT(false);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+// number of frames to render after an input event or invalidation, ImGui often needs more than 1 frame to settle
+static constexpr const uint kNumFramesAfterEvent = 2;
+
+// default target frame rate, used for the idle callback timer
+static constexpr const uint kDefaultFrameRate = 60;
+
+// number of font textures to keep per widget besides the one in use, for switching back to a recent font size
+static constexpr const uint kMaxCachedFontTextures = 2;
+
+// number of frames kept around for profiling
+static constexpr const uint kNumFrameStats = 120;
+
 template <class BaseWidget>
 struct ImGuiWidget<BaseWidget>::PrivateData {
     ImGuiWidget<BaseWidget>* const self;
     ImGuiContext* context;
+    ImFontAtlas* fontAtlas;
+    ImFontAtlas* fontTextureAtlas;
+    bool fontAtlasChanged;
     double scaleFactor;
     double lastFrameTime;
     uint lastModifiers;
+    bool renderOnDemand;
+    uint pendingFrames;
+    bool focused;
+    uint targetFrameRate;
+    uint unfocusedFrameRate;
+    double frameTimeBudget;
+    double averageFrameTime;
+    bool frameCaching;
+    bool renderToTexture;
+    bool frameRequested;
+    bool frameCacheNeedsCleanup;
+    bool hasLastFingerprint;
+    ImU32 lastFingerprint;
+    bool drawCommandMerging;
+    uint numMergedDrawCommands;
+    bool hasPendingMousePos;
+    ImVec2 pendingMousePos;
+    bool hasPendingMouseWheel;
+    ImVec2 pendingMouseWheel;
+    uint numMergedMotionEvents;
+    uint numMergedScrollEvents;
+    bool profiling;
+    bool profilingOverlay;
+    uint numFrameStats;
+    uint lastFrameStatsIndex;
+    uint frameStatsCounter;
+    FrameStats frameStats[kNumFrameStats];
+
+    struct CachedFontTexture {
+        ImFontAtlas* atlas;
+        ImTextureID texture;
+    };
+    ImVector<CachedFontTexture> cachedFontTextures;
+
+    struct DrawListState {
+        const ImDrawList* list;
+        ImU32 hash;
+        ImVec4 bounds;
+    };
+    ImVector<DrawListState> drawListStates;
+    ImVector<DrawListState> lastDrawListStates;
 
     explicit PrivateData(ImGuiWidget<BaseWidget>* const s, const float fontSize)
         : self(s),
           context(nullptr),
+          fontAtlas(nullptr),
+          fontTextureAtlas(nullptr),
+          fontAtlasChanged(false),
           scaleFactor(s->getTopLevelWidget()->getScaleFactor()),
           lastFrameTime(0.0),
-          lastModifiers(0)
+          lastModifiers(0),
+          renderOnDemand(false),
+          pendingFrames(kNumFramesAfterEvent),
+          focused(true),
+          targetFrameRate(kDefaultFrameRate),
+          unfocusedFrameRate(0),
+          frameTimeBudget(0.0),
+          averageFrameTime(0.0),
+          frameCaching(false),
+          renderToTexture(false),
+          frameRequested(false),
+          frameCacheNeedsCleanup(false),
+          hasLastFingerprint(false),
+          lastFingerprint(0),
+          drawCommandMerging(false),
+          numMergedDrawCommands(0),
+          hasPendingMousePos(false),
+          pendingMousePos(),
+          hasPendingMouseWheel(false),
+          pendingMouseWheel(),
+          numMergedMotionEvents(0),
+          numMergedScrollEvents(0),
+          profiling(false),
+          profilingOverlay(false),
+          numFrameStats(0),
+          lastFrameStatsIndex(0),
+          frameStatsCounter(0),
+          frameStats()
     {
         IMGUI_CHECKVERSION();
-        context = ImGui::CreateContext();
+        fontAtlas = acquireSharedFontAtlas(getFontPixelSize(fontSize, scaleFactor));
+        context = ImGui::CreateContext(fontAtlas);
         ImGui::SetCurrentContext(context);
 
         ImGuiIO& io(ImGui::GetIO());
@@ -112,20 +338,6 @@ struct ImGuiWidget<BaseWidget>::PrivateData {
         ImGuiStyle& style(ImGui::GetStyle());
         style.ScaleAllSizes(scaleFactor);
 
-       #ifndef DGL_NO_SHARED_RESOURCES
-        using namespace dpf_resources;
-        ImFontConfig fc;
-        fc.FontDataOwnedByAtlas = false;
-        fc.OversampleH = 1;
-        fc.OversampleV = 1;
-        fc.PixelSnapH = true;
-        io.Fonts->AddFontFromMemoryTTF((void*)dejavusans_ttf,
-                                       dejavusans_ttf_size,
-                                       d_roundToIntPositive(fontSize * scaleFactor),
-                                       &fc);
-        io.Fonts->Build();
-       #endif
-
         io.GetClipboardTextFn = GetClipboardTextFn;
         io.SetClipboardTextFn = SetClipboardTextFn;
         io.ClipboardUserData = s->getTopLevelWidget();
@@ -140,18 +352,107 @@ struct ImGuiWidget<BaseWidget>::PrivateData {
     ~PrivateData()
     {
         ImGui::SetCurrentContext(context);
+
+        for (const CachedFontTexture& cached : cachedFontTextures)
+        {
+           #if defined(DGL_USE_GLES2) || defined(DGL_USE_GLES3) || defined(DGL_USE_OPENGL3)
+            ImGui_ImplOpenGL3_DestroyTexture(cached.texture);
+           #else
+            ImGui_ImplOpenGL2_DestroyTexture(cached.texture);
+           #endif
+            releaseSharedFontAtlas(cached.atlas);
+        }
+
        #if defined(DGL_USE_GLES2) || defined(DGL_USE_GLES3) || defined(DGL_USE_OPENGL3)
         ImGui_ImplOpenGL3_Shutdown();
        #else
         ImGui_ImplOpenGL2_Shutdown();
        #endif
         ImGui::DestroyContext(context);
+
+        if (fontTextureAtlas != nullptr)
+            releaseSharedFontAtlas(fontTextureAtlas);
+
+        releaseSharedFontAtlas(fontAtlas);
     }
 
     float getDisplayX() const noexcept;
     float getDisplayY() const noexcept;
     double getTime() const noexcept;
 
+    // switch to another shared font atlas, the GL texture is swapped on the next frame
+    void setFontAtlas(ImFontAtlas* const atlas)
+    {
+        if (atlas == fontAtlas)
+        {
+            releaseSharedFontAtlas(atlas);
+            return;
+        }
+
+        releaseSharedFontAtlas(fontAtlas);
+        fontAtlas = atlas;
+        fontAtlasChanged = true;
+        hasLastFingerprint = false;
+
+        ImGui::SetCurrentContext(context);
+        ImGui::GetIO().Fonts = atlas;
+    }
+
+    // keep the font texture of the previous atlas around, and reuse a cached one for the new atlas if possible
+    // must be called while drawing, before the backend new frame
+    void swapFontTexture()
+    {
+        if (fontTextureAtlas != nullptr)
+        {
+           #if defined(DGL_USE_GLES2) || defined(DGL_USE_GLES3) || defined(DGL_USE_OPENGL3)
+            const ImTextureID texture = ImGui_ImplOpenGL3_ReleaseFontsTexture();
+           #else
+            const ImTextureID texture = ImGui_ImplOpenGL2_ReleaseFontsTexture();
+           #endif
+
+            if (texture != 0)
+            {
+                const CachedFontTexture cached = { fontTextureAtlas, texture };
+                cachedFontTextures.push_front(cached);
+            }
+            else
+            {
+                releaseSharedFontAtlas(fontTextureAtlas);
+            }
+
+            fontTextureAtlas = nullptr;
+        }
+
+        for (CachedFontTexture& cached : cachedFontTextures)
+        {
+            if (cached.atlas != fontAtlas)
+                continue;
+
+           #if defined(DGL_USE_GLES2) || defined(DGL_USE_GLES3) || defined(DGL_USE_OPENGL3)
+            ImGui_ImplOpenGL3_SetFontsTexture(cached.texture);
+           #else
+            ImGui_ImplOpenGL2_SetFontsTexture(cached.texture);
+           #endif
+
+            // reference moves from the cache entry
+            fontTextureAtlas = cached.atlas;
+            cachedFontTextures.erase(&cached);
+            break;
+        }
+
+        while (cachedFontTextures.size() > static_cast<int>(kMaxCachedFontTextures))
+        {
+            const CachedFontTexture& cached = cachedFontTextures.back();
+           #if defined(DGL_USE_GLES2) || defined(DGL_USE_GLES3) || defined(DGL_USE_OPENGL3)
+            ImGui_ImplOpenGL3_DestroyTexture(cached.texture);
+           #else
+            ImGui_ImplOpenGL2_DestroyTexture(cached.texture);
+           #endif
+            releaseSharedFontAtlas(cached.atlas);
+            cachedFontTextures.pop_back();
+        }
+    }
+
     inline double getTimeDelta() noexcept
     {
         const double time = getTime();
@@ -165,6 +466,8 @@ struct ImGuiWidget<BaseWidget>::PrivateData {
         if (lastModifiers == mods)
             return;
 
+        flushPointerInput(io);
+
         if ((mods & kModifierShift) != (lastModifiers & kModifierShift))
             io.AddKeyEvent(ImGuiMod_Shift, mods & kModifierShift);
 
@@ -180,6 +483,437 @@ struct ImGuiWidget<BaseWidget>::PrivateData {
         lastModifiers = mods;
     }
 
+    // motion and scroll events are coalesced until the next frame or the next event whose ordering matters
+    void queueMousePos(const float x, const float y) noexcept
+    {
+        if (hasPendingMousePos)
+            ++numMergedMotionEvents;
+
+        hasPendingMousePos = true;
+        pendingMousePos = ImVec2(x, y);
+    }
+
+    void queueMouseWheel(const float x, const float y) noexcept
+    {
+        if (hasPendingMouseWheel)
+            ++numMergedScrollEvents;
+
+        hasPendingMouseWheel = true;
+        pendingMouseWheel += ImVec2(x, y);
+    }
+
+    void flushPointerInput(ImGuiIO& io)
+    {
+        if (hasPendingMousePos)
+        {
+            hasPendingMousePos = false;
+            io.AddMousePosEvent(pendingMousePos.x, pendingMousePos.y);
+        }
+
+        if (hasPendingMouseWheel)
+        {
+            hasPendingMouseWheel = false;
+            io.AddMouseWheelEvent(pendingMouseWheel.x, pendingMouseWheel.y);
+            pendingMouseWheel = ImVec2();
+        }
+    }
+
+    // time between frames according to the current frame rate policy, in seconds
+    double getFrameInterval() const noexcept
+    {
+        uint frameRate = targetFrameRate;
+
+        if (! focused && unfocusedFrameRate != 0)
+            frameRate = ImMin(frameRate, unfocusedFrameRate);
+
+        double interval = 1.0 / frameRate;
+
+        // back off proportionally when frames take longer than budgeted
+        if (frameTimeBudget > 0.0 && averageFrameTime > frameTimeBudget)
+            interval *= averageFrameTime / frameTimeBudget;
+
+        return ImMin(interval, 1.0);
+    }
+
+    // check if enough time has passed since the last frame, idle ticks happen at the target frame rate
+    bool isFrameDue() const noexcept
+    {
+        const double interval = getFrameInterval();
+        const double targetInterval = 1.0 / targetFrameRate;
+
+        if (interval <= targetInterval)
+            return true;
+
+        // allow half a tick of jitter, so we do not skip one tick too many
+        return getTime() - lastFrameTime + targetInterval * 0.5 >= interval;
+    }
+
+    inline void updateAverageFrameTime(const double frameTime) noexcept
+    {
+        averageFrameTime += (frameTime - averageFrameTime) * 0.1;
+    }
+
+    // cheap content fingerprint of the draw data, made from the hashes of each draw list
+    // also records the hash and screen bounds of every draw list, see getDamageRect()
+    static bool getDrawDataFingerprint(const ImDrawData* const data, ImU32& fingerprint,
+                                       ImVector<DrawListState>& states) noexcept
+    {
+        ImU32 hash = ImHashData(&data->DisplaySize, sizeof(ImVec2));
+
+        states.resize(data->CmdListsCount);
+
+        for (int i = 0; i < data->CmdListsCount; ++i)
+        {
+            const ImDrawList* const list = data->CmdLists[i];
+            DrawListState& state(states[i]);
+
+            // union of the clip rectangles, user callbacks can render anything so we cannot cache those
+            ImVec4 clip(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+            for (const ImDrawCmd& cmd : list->CmdBuffer)
+            {
+                if (cmd.UserCallback != nullptr && cmd.UserCallback != ImDrawCallback_ResetRenderState)
+                    return false;
+
+                clip.x = ImMin(clip.x, cmd.ClipRect.x);
+                clip.y = ImMin(clip.y, cmd.ClipRect.y);
+                clip.z = ImMax(clip.z, cmd.ClipRect.z);
+                clip.w = ImMax(clip.w, cmd.ClipRect.w);
+            }
+
+            // bounding box of the vertices, limited to what the clip rectangles allow to be drawn
+            ImVec2 min(FLT_MAX, FLT_MAX), max(-FLT_MAX, -FLT_MAX);
+            for (const ImDrawVert& vert : list->VtxBuffer)
+            {
+                min = ImMin(min, vert.pos);
+                max = ImMax(max, vert.pos);
+            }
+
+            state.list = list;
+            state.hash = ImHashData(list->CmdBuffer.Data, list->CmdBuffer.size_in_bytes());
+            state.hash = ImHashData(list->IdxBuffer.Data, list->IdxBuffer.size_in_bytes(), state.hash);
+            state.hash = ImHashData(list->VtxBuffer.Data, list->VtxBuffer.size_in_bytes(), state.hash);
+            state.bounds = ImVec4(ImMax(min.x, clip.x), ImMax(min.y, clip.y),
+                                  ImMin(max.x, clip.z), ImMin(max.y, clip.w));
+
+            hash = ImHashData(&state.hash, sizeof(ImU32), hash);
+        }
+
+        fingerprint = hash;
+        return true;
+    }
+
+    // region covered by the draw lists that changed since the last frame, in ImGui coordinates
+    // draw lists are compared in order, so a change in their order damages both old and new bounds
+    ImVec4 getDamageRect() const noexcept
+    {
+        ImVec4 damage(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+
+        const auto addBounds = [&damage](const ImVec4& bounds) {
+            if (bounds.x >= bounds.z || bounds.y >= bounds.w)
+                return;
+            damage.x = ImMin(damage.x, bounds.x);
+            damage.y = ImMin(damage.y, bounds.y);
+            damage.z = ImMax(damage.z, bounds.z);
+            damage.w = ImMax(damage.w, bounds.w);
+        };
+
+        for (int i = 0, count = ImMax(drawListStates.Size, lastDrawListStates.Size); i < count; ++i)
+        {
+            if (i < drawListStates.Size && i < lastDrawListStates.Size)
+            {
+                const DrawListState& state(drawListStates[i]);
+                const DrawListState& last(lastDrawListStates[i]);
+
+                if (state.list == last.list && state.hash == last.hash)
+                    continue;
+            }
+
+            if (i < drawListStates.Size)
+                addBounds(drawListStates[i].bounds);
+            if (i < lastDrawListStates.Size)
+                addBounds(lastDrawListStates[i].bounds);
+        }
+
+        // nothing visible changed, leave an empty region
+        if (damage.x > damage.z)
+            return ImVec4(0.f, 0.f, 0.f, 0.f);
+
+        return damage;
+    }
+
+    // bounding box of the vertices used by a draw command
+    static ImVec4 getDrawCommandBounds(const ImDrawList* const list, const ImDrawCmd& cmd) noexcept
+    {
+        const ImDrawVert* const vtx = list->VtxBuffer.Data + cmd.VtxOffset;
+        const ImDrawIdx* const idx = list->IdxBuffer.Data + cmd.IdxOffset;
+        ImVec2 min(FLT_MAX, FLT_MAX), max(-FLT_MAX, -FLT_MAX);
+
+        for (uint i = 0; i < cmd.ElemCount; ++i)
+        {
+            min = ImMin(min, vtx[idx[i]].pos);
+            max = ImMax(max, vtx[idx[i]].pos);
+        }
+
+        return ImVec4(min.x, min.y, max.x, max.y);
+    }
+
+    // merge consecutive draw commands using the same texture, returning the number of commands removed.
+    // commands with different clip rectangles are merged (using the union of both) only if the geometry of each one
+    // is fully inside its own clip rectangle, so that clipping has no effect on them.
+    // a margin of 2 framebuffer pixels is kept to account for backends truncating clip rectangles into scissor boxes.
+    static uint mergeDrawCommands(ImDrawData* const data) noexcept
+    {
+        const ImVec2 margin(2.f / data->FramebufferScale.x, 2.f / data->FramebufferScale.y);
+        uint numMerged = 0;
+
+        const auto isInsideClipRect = [&margin](const ImVec4& bounds, const ImVec4& clip) {
+            return bounds.x >= clip.x + margin.x && bounds.y >= clip.y + margin.y
+                && bounds.z <= clip.z - margin.x && bounds.w <= clip.w - margin.y;
+        };
+
+        for (int i = 0; i < data->CmdListsCount; ++i)
+        {
+            ImDrawList* const list = data->CmdLists[i];
+            ImVector<ImDrawCmd>& cmds(list->CmdBuffer);
+
+            if (cmds.Size < 2)
+                continue;
+
+            // last command written and whether it can take in the next one, with clipping having no effect on it
+            int last = 0;
+            bool lastMergeable = cmds[0].UserCallback == nullptr;
+            bool lastInside = lastMergeable && isInsideClipRect(getDrawCommandBounds(list, cmds[0]), cmds[0].ClipRect);
+
+            for (int j = 1; j < cmds.Size; ++j)
+            {
+                const ImDrawCmd cmd(cmds[j]);
+                ImDrawCmd& prev(cmds[last]);
+
+                if (lastMergeable
+                    && cmd.UserCallback == nullptr
+                    && cmd.TextureId == prev.TextureId
+                    && cmd.VtxOffset == prev.VtxOffset
+                    && cmd.IdxOffset == prev.IdxOffset + prev.ElemCount)
+                {
+                    const bool inside = isInsideClipRect(getDrawCommandBounds(list, cmd), cmd.ClipRect);
+
+                    if (memcmp(&cmd.ClipRect, &prev.ClipRect, sizeof(ImVec4)) == 0 || (lastInside && inside))
+                    {
+                        prev.ClipRect = ImVec4(ImMin(prev.ClipRect.x, cmd.ClipRect.x),
+                                               ImMin(prev.ClipRect.y, cmd.ClipRect.y),
+                                               ImMax(prev.ClipRect.z, cmd.ClipRect.z),
+                                               ImMax(prev.ClipRect.w, cmd.ClipRect.w));
+                        prev.ElemCount += cmd.ElemCount;
+                        lastInside = lastInside && inside;
+                        ++numMerged;
+                        continue;
+                    }
+
+                    cmds[++last] = cmd;
+                    lastInside = inside;
+                    continue;
+                }
+
+                cmds[++last] = cmd;
+                lastMergeable = cmd.UserCallback == nullptr;
+                lastInside = lastMergeable && isInsideClipRect(getDrawCommandBounds(list, cmd), cmd.ClipRect);
+            }
+
+            cmds.resize(last + 1);
+        }
+
+        return numMerged;
+    }
+
+    inline uint getTextureUploadCount() const noexcept
+    {
+       #if defined(DGL_USE_GLES2) || defined(DGL_USE_GLES3) || defined(DGL_USE_OPENGL3)
+        return ImGui_ImplOpenGL3_GetTextureUploadCount();
+       #else
+        return ImGui_ImplOpenGL2_GetTextureUploadCount();
+       #endif
+    }
+
+    // GPU time is measured asynchronously, each measurement is tagged with the counter of the frame it belongs to
+    inline bool beginGpuTimer() const
+    {
+       #if defined(DGL_USE_GLES2) || defined(DGL_USE_GLES3) || defined(DGL_USE_OPENGL3)
+        return ImGui_ImplOpenGL3_BeginGpuTimer(static_cast<int>(frameStatsCounter + 1));
+       #else
+        return ImGui_ImplOpenGL2_BeginGpuTimer(static_cast<int>(frameStatsCounter + 1));
+       #endif
+    }
+
+    inline void endGpuTimer() const
+    {
+       #if defined(DGL_USE_GLES2) || defined(DGL_USE_GLES3) || defined(DGL_USE_OPENGL3)
+        ImGui_ImplOpenGL3_EndGpuTimer();
+       #else
+        ImGui_ImplOpenGL2_EndGpuTimer();
+       #endif
+    }
+
+    // assign finished GPU time measurements to their frames, if still around
+    void updateGpuTimes()
+    {
+        int tag;
+        double milliseconds;
+
+       #if defined(DGL_USE_GLES2) || defined(DGL_USE_GLES3) || defined(DGL_USE_OPENGL3)
+        while (ImGui_ImplOpenGL3_GetGpuTimerResult(&tag, &milliseconds))
+       #else
+        while (ImGui_ImplOpenGL2_GetGpuTimerResult(&tag, &milliseconds))
+       #endif
+        {
+            const uint age = frameStatsCounter - static_cast<uint>(tag);
+
+            if (age < numFrameStats)
+                frameStats[(lastFrameStatsIndex + kNumFrameStats - age) % kNumFrameStats].gpuTime = milliseconds;
+        }
+    }
+
+    // store the statistics of the frame that was just rendered, replacing the oldest one
+    void addFrameStats(const double startTime,
+                       const double newFrameEndTime,
+                       const double displayEndTime,
+                       const double renderEndTime,
+                       const uint textureUploadsBefore,
+                       const ImDrawData* const data)
+    {
+        lastFrameStatsIndex = (lastFrameStatsIndex + 1) % kNumFrameStats;
+        ++frameStatsCounter;
+
+        if (numFrameStats < kNumFrameStats)
+            ++numFrameStats;
+
+        FrameStats& stats(frameStats[lastFrameStatsIndex]);
+        stats.newFrameTime = (newFrameEndTime - startTime) * 1000.0;
+        stats.displayTime = (displayEndTime - newFrameEndTime) * 1000.0;
+        stats.renderTime = (renderEndTime - displayEndTime) * 1000.0;
+        stats.renderDrawDataTime = (getTime() - renderEndTime) * 1000.0;
+        stats.gpuTime = -1.0;
+        stats.drawLists = 0;
+        stats.drawCommands = 0;
+        stats.drawCalls = 0;
+        stats.vertices = 0;
+        stats.indices = 0;
+        stats.textureUploads = getTextureUploadCount() - textureUploadsBefore;
+
+        if (data == nullptr)
+            return;
+
+        stats.drawLists = data->CmdListsCount;
+        stats.vertices = data->TotalVtxCount;
+        stats.indices = data->TotalIdxCount;
+
+        for (int i = 0; i < data->CmdListsCount; ++i)
+            stats.drawCalls += data->CmdLists[i]->CmdBuffer.Size;
+
+        stats.drawCommands = stats.drawCalls + numMergedDrawCommands;
+    }
+
+    // small window on the top-left corner with the averages of recent frames
+    void showProfilingOverlay()
+    {
+        if (numFrameStats == 0)
+            return;
+
+        FrameStats avg = {};
+        float totals[kNumFrameStats];
+        uint numGpuTimes = 0;
+
+        for (uint i = 0; i < numFrameStats; ++i)
+        {
+            // oldest first
+            const FrameStats& stats(frameStats[(lastFrameStatsIndex + kNumFrameStats - numFrameStats + 1 + i) % kNumFrameStats]);
+            avg.newFrameTime += stats.newFrameTime;
+            avg.displayTime += stats.displayTime;
+            avg.renderTime += stats.renderTime;
+            avg.renderDrawDataTime += stats.renderDrawDataTime;
+            totals[i] = stats.newFrameTime + stats.displayTime + stats.renderTime + stats.renderDrawDataTime;
+
+            if (stats.gpuTime >= 0.0)
+            {
+                avg.gpuTime += stats.gpuTime;
+                ++numGpuTimes;
+            }
+        }
+
+        const FrameStats& last(frameStats[lastFrameStatsIndex]);
+
+        ImGui::SetNextWindowPos(ImVec2(4 * scaleFactor, 4 * scaleFactor));
+        ImGui::SetNextWindowBgAlpha(0.75f);
+
+        if (ImGui::Begin("##dpf-profiling", nullptr, ImGuiWindowFlags_NoDecoration
+                                                   | ImGuiWindowFlags_AlwaysAutoResize
+                                                   | ImGuiWindowFlags_NoSavedSettings
+                                                   | ImGuiWindowFlags_NoFocusOnAppearing
+                                                   | ImGuiWindowFlags_NoNav
+                                                   | ImGuiWindowFlags_NoInputs))
+        {
+            ImGui::Text("NewFrame %.3f ms", avg.newFrameTime / numFrameStats);
+            ImGui::Text("Display %.3f ms", avg.displayTime / numFrameStats);
+            ImGui::Text("Render %.3f ms", avg.renderTime / numFrameStats);
+            ImGui::Text("RenderDrawData %.3f ms", avg.renderDrawDataTime / numFrameStats);
+            if (numGpuTimes != 0)
+                ImGui::Text("GPU %.3f ms", avg.gpuTime / numGpuTimes);
+            ImGui::Text("%u lists, %u cmds, %u draws, %u vtx, %u idx, %u uploads",
+                        last.drawLists, last.drawCommands, last.drawCalls, last.vertices, last.indices, last.textureUploads);
+            ImGui::PlotLines("##frame-times", totals, numFrameStats, 0, nullptr, 0.f, FLT_MAX,
+                             ImVec2(0, 40 * scaleFactor));
+        }
+
+        ImGui::End();
+    }
+
+    inline void scheduleFrames(const uint numFrames) noexcept
+    {
+        if (pendingFrames < numFrames)
+            pendingFrames = numFrames;
+    }
+
+    // check if ImGui has work in progress that needs more frames even without new input events
+    bool hasPendingWork() const noexcept
+    {
+        const ImGuiContext& g(*context);
+
+        // input events not processed yet, ImGui trickles some of them over several frames (e.g. quick double-clicks)
+        if (g.InputEventsQueue.Size != 0)
+            return true;
+
+        // widget being interacted with, or text input with a blinking cursor
+        if (g.ActiveId != 0 || g.IO.WantTextInput)
+            return true;
+
+        // mouse buttons being held down (drag and drop, repeating buttons, etc)
+        for (int i = 0; i < ImGuiMouseButton_COUNT; ++i)
+            if (g.IO.MouseDown[i])
+                return true;
+
+        // keys being held down, for key repeat (navigation, shortcuts, etc), modifiers alone do nothing
+        for (int key = ImGuiKey_Keyboard_BEGIN; key < ImGuiKey_Keyboard_END; ++key)
+            if (g.IO.KeysData[key - ImGuiKey_NamedKey_BEGIN].Down && ! ImGui::IsLRModKey(static_cast<ImGuiKey>(key)))
+                return true;
+
+        // open popups and menus
+        if (g.OpenPopupStack.Size != 0)
+            return true;
+
+        // keyboard navigation and window switching, including its fade out
+        if (g.NavAnyRequest || g.NavWindowingTarget != nullptr || g.NavWindowingTargetAnim != nullptr)
+            return true;
+
+        // modal background dimming fade
+        if (g.DimBgRatio > 0.f && g.DimBgRatio < 1.f)
+            return true;
+
+        // delayed tooltips
+        if (g.HoverItemDelayId != 0 && g.HoverItemDelayTimer < g.Style.HoverStationaryDelay + g.Style.HoverDelayNormal)
+            return true;
+
+        return false;
+    }
+
     DISTRHO_DECLARE_NON_COPYABLE(PrivateData)
 };
 
@@ -188,30 +922,214 @@ struct ImGuiWidget<BaseWidget>::PrivateData {
 template <class BaseWidget>
 void ImGuiWidget<BaseWidget>::setFontSize(const float fontSize)
 {
+    const double scaleFactor = BaseWidget::getTopLevelWidget()->getScaleFactor();
+
+    // acquire the new atlas before releasing the old one, so it is not destroyed if both are the same
+    imData->setFontAtlas(acquireSharedFontAtlas(getFontPixelSize(fontSize, scaleFactor)));
+
+    imData->scheduleFrames(kNumFramesAfterEvent);
+}
+
+template <class BaseWidget>
+void ImGuiWidget<BaseWidget>::setRenderOnDemand(const bool renderOnDemand)
+{
+    imData->renderOnDemand = renderOnDemand;
+    imData->scheduleFrames(kNumFramesAfterEvent);
+}
+
+template <class BaseWidget>
+void ImGuiWidget<BaseWidget>::invalidate()
+{
+    imData->hasLastFingerprint = false;
+    imData->scheduleFrames(kNumFramesAfterEvent);
+}
+
+template <class BaseWidget>
+void ImGuiWidget<BaseWidget>::setTargetFrameRate(const uint frameRate)
+{
+    DISTRHO_SAFE_ASSERT_RETURN(frameRate != 0 && frameRate <= 1000,);
+
+    if (imData->targetFrameRate == frameRate)
+        return;
+
+    imData->targetFrameRate = frameRate;
+
+    Window& window(BaseWidget::getWindow());
+    window.removeIdleCallback(this);
+    window.addIdleCallback(this, 1000 / frameRate);
+}
+
+template <class BaseWidget>
+void ImGuiWidget<BaseWidget>::setUnfocusedFrameRate(const uint frameRate)
+{
+    imData->unfocusedFrameRate = frameRate;
+}
+
+template <class BaseWidget>
+void ImGuiWidget<BaseWidget>::setFrameTimeBudget(const double milliseconds)
+{
+    DISTRHO_SAFE_ASSERT_RETURN(milliseconds >= 0.0,);
+
+    imData->frameTimeBudget = milliseconds / 1000.0;
+}
+
+template <class BaseWidget>
+void ImGuiWidget<BaseWidget>::setFocused(const bool focused)
+{
+    if (imData->focused == focused)
+        return;
+
+    imData->focused = focused;
+
     ImGui::SetCurrentContext(imData->context);
+
     ImGuiIO& io(ImGui::GetIO());
+    imData->flushPointerInput(io);
+    io.AddFocusEvent(focused);
+    imData->scheduleFrames(kNumFramesAfterEvent);
+}
 
-    const double scaleFactor = BaseWidget::getTopLevelWidget()->getScaleFactor();
+template <class BaseWidget>
+void ImGuiWidget<BaseWidget>::setFrameCaching(const bool frameCaching)
+{
+    if (imData->frameCaching == frameCaching)
+        return;
 
-   #ifndef DGL_NO_SHARED_RESOURCES
-    using namespace dpf_resources;
-    ImFontConfig fc;
-    fc.FontDataOwnedByAtlas = false;
-    fc.OversampleH = 1;
-    fc.OversampleV = 1;
-    fc.PixelSnapH = true;
-    io.Fonts->Clear();
-    io.Fonts->AddFontFromMemoryTTF((void*)dejavusans_ttf,
-                                   dejavusans_ttf_size,
-                                   d_roundToIntPositive(fontSize * scaleFactor),
-                                   &fc);
-    io.Fonts->Build();
+    imData->frameCaching = frameCaching;
+    imData->hasLastFingerprint = false;
+
+    // GL resources can only be released while drawing
+    if (! frameCaching && ! imData->renderToTexture)
+        imData->frameCacheNeedsCleanup = true;
+}
+
+template <class BaseWidget>
+void ImGuiWidget<BaseWidget>::setRenderToTexture(const bool renderToTexture)
+{
+    if (imData->renderToTexture == renderToTexture)
+        return;
+
+    imData->renderToTexture = renderToTexture;
+    imData->hasLastFingerprint = false;
+    imData->scheduleFrames(kNumFramesAfterEvent);
+
+    // GL resources can only be released while drawing
+    if (! renderToTexture && ! imData->frameCaching)
+        imData->frameCacheNeedsCleanup = true;
+}
+
+template <class BaseWidget>
+void ImGuiWidget<BaseWidget>::setDrawCommandMerging(const bool drawCommandMerging)
+{
+    imData->drawCommandMerging = drawCommandMerging;
+}
+
+template <class BaseWidget>
+void ImGuiWidget<BaseWidget>::setShaderCacheDirectory(const char* const path)
+{
+   #if defined(DGL_USE_GLES2) || defined(DGL_USE_GLES3) || defined(DGL_USE_OPENGL3)
+    ImGui_ImplOpenGL3_SetProgramBinaryCacheDirectory(path);
+   #else
+    // OpenGL 2.x backend does not use shaders
+    (void)path;
    #endif
 }
 
+template <class BaseWidget>
+ImTextureID ImGuiWidget<BaseWidget>::createTexture(const uint width, const uint height)
+{
+    DISTRHO_SAFE_ASSERT_RETURN(width != 0 && height != 0, ImTextureID());
+
+    ImGui::SetCurrentContext(imData->context);
+
+   #if defined(DGL_USE_GLES2) || defined(DGL_USE_GLES3) || defined(DGL_USE_OPENGL3)
+    return ImGui_ImplOpenGL3_CreateUserTexture(static_cast<int>(width), static_cast<int>(height));
+   #else
+    return ImGui_ImplOpenGL2_CreateUserTexture(static_cast<int>(width), static_cast<int>(height));
+   #endif
+}
+
+template <class BaseWidget>
+void ImGuiWidget<BaseWidget>::updateTexture(const ImTextureID texture,
+                                            const uint x, const uint y, const uint width, const uint height,
+                                            const void* const pixels, const uint stride)
+{
+    DISTRHO_SAFE_ASSERT_RETURN(pixels != nullptr,);
+
+    ImGui::SetCurrentContext(imData->context);
+
+   #if defined(DGL_USE_GLES2) || defined(DGL_USE_GLES3) || defined(DGL_USE_OPENGL3)
+    ImGui_ImplOpenGL3_UpdateUserTexture(texture, static_cast<int>(x), static_cast<int>(y),
+                                        static_cast<int>(width), static_cast<int>(height),
+                                        pixels, static_cast<int>(stride));
+   #else
+    ImGui_ImplOpenGL2_UpdateUserTexture(texture, static_cast<int>(x), static_cast<int>(y),
+                                        static_cast<int>(width), static_cast<int>(height),
+                                        pixels, static_cast<int>(stride));
+   #endif
+
+    invalidate();
+}
+
+template <class BaseWidget>
+void ImGuiWidget<BaseWidget>::destroyTexture(const ImTextureID texture)
+{
+    ImGui::SetCurrentContext(imData->context);
+
+   #if defined(DGL_USE_GLES2) || defined(DGL_USE_GLES3) || defined(DGL_USE_OPENGL3)
+    ImGui_ImplOpenGL3_DestroyUserTexture(texture);
+   #else
+    ImGui_ImplOpenGL2_DestroyUserTexture(texture);
+   #endif
+}
+
+template <class BaseWidget>
+uint ImGuiWidget<BaseWidget>::getNumMergedMotionEvents() const noexcept
+{
+    return imData->numMergedMotionEvents;
+}
+
+template <class BaseWidget>
+uint ImGuiWidget<BaseWidget>::getNumMergedScrollEvents() const noexcept
+{
+    return imData->numMergedScrollEvents;
+}
+
+template <class BaseWidget>
+void ImGuiWidget<BaseWidget>::setProfiling(const bool profiling, const bool showOverlay)
+{
+    if (imData->profiling != profiling)
+        imData->numFrameStats = 0;
+
+    imData->profiling = profiling;
+    imData->profilingOverlay = profiling && showOverlay;
+    imData->scheduleFrames(kNumFramesAfterEvent);
+}
+
+template <class BaseWidget>
+uint ImGuiWidget<BaseWidget>::getNumFrameStats() const noexcept
+{
+    return imData->numFrameStats;
+}
+
+template <class BaseWidget>
+bool ImGuiWidget<BaseWidget>::getFrameStats(const uint index, FrameStats& stats) const noexcept
+{
+    DISTRHO_SAFE_ASSERT_RETURN(index < imData->numFrameStats, false);
+
+    stats = imData->frameStats[(imData->lastFrameStatsIndex + kNumFrameStats - index) % kNumFrameStats];
+    return true;
+}
+
 template <class BaseWidget>
 void ImGuiWidget<BaseWidget>::idleCallback()
 {
+    if (imData->renderOnDemand && imData->pendingFrames == 0)
+        return;
+    if (! imData->isFrameDue())
+        return;
+
+    imData->frameRequested = true;
     BaseWidget::repaint();
 }
 
@@ -226,9 +1144,44 @@ void ImGuiWidget<BaseWidget>::onDisplay()
 
     ImGui::SetCurrentContext(imData->context);
 
+    // repaints not requested by ourselves (e.g. parent widget redraws) composite the previous frame again
+    if (imData->renderToTexture && ! imData->frameRequested && imData->hasLastFingerprint)
+    {
+        if (ImDrawData* const data = ImGui::GetDrawData())
+        {
+            data->DisplayPos.x = -imData->getDisplayX();
+            data->DisplayPos.y = imData->getDisplayY();
+
+           #if defined(DGL_USE_GLES2) || defined(DGL_USE_GLES3) || defined(DGL_USE_OPENGL3)
+            const bool composited = ImGui_ImplOpenGL3_RenderCachedDrawData(data);
+           #else
+            const bool composited = ImGui_ImplOpenGL2_RenderCachedDrawData(data);
+           #endif
+
+            if (composited)
+            {
+               #ifdef DGL_USE_OPENGL3
+                glUseProgram(gl3context.program);
+               #endif
+                return;
+            }
+        }
+    }
+
+    imData->frameRequested = false;
+
     ImGuiIO& io(ImGui::GetIO());
 
     io.DeltaTime = imData->getTimeDelta();
+    imData->flushPointerInput(io);
+
+    const uint textureUploadsBefore = imData->profiling ? imData->getTextureUploadCount() : 0;
+
+    if (imData->fontAtlasChanged)
+    {
+        imData->fontAtlasChanged = false;
+        imData->swapFontTexture();
+    }
 
    #if defined(DGL_USE_GLES2) || defined(DGL_USE_GLES3) || defined(DGL_USE_OPENGL3)
     ImGui_ImplOpenGL3_NewFrame();
@@ -236,9 +1189,29 @@ void ImGuiWidget<BaseWidget>::onDisplay()
     ImGui_ImplOpenGL2_NewFrame();
    #endif
 
+    // the backend has created a new font texture if there was none cached
+    if (imData->fontTextureAtlas == nullptr)
+    {
+        imData->fontTextureAtlas = imData->fontAtlas;
+        retainSharedFontAtlas(imData->fontAtlas);
+    }
+
     ImGui::NewFrame();
+    const double newFrameEndTime = imData->profiling ? imData->getTime() : 0.0;
+
     onImGuiDisplay();
+    const double displayEndTime = imData->profiling ? imData->getTime() : 0.0;
+
+    if (imData->profilingOverlay)
+        imData->showProfilingOverlay();
+
     ImGui::Render();
+    const double renderEndTime = imData->profiling ? imData->getTime() : 0.0;
+
+    if (imData->pendingFrames != 0)
+        --imData->pendingFrames;
+    if (imData->hasPendingWork())
+        imData->scheduleFrames(1);
 
     /*
     const GraphicsContext& gc(getGraphicsContext());
@@ -247,20 +1220,75 @@ void ImGuiWidget<BaseWidget>::onDisplay()
     r.draw(gc);
     */
 
-    if (ImDrawData* const data = ImGui::GetDrawData())
+    if (imData->frameCacheNeedsCleanup)
     {
-        data->DisplayPos.x = -imData->getDisplayX();
-        data->DisplayPos.y = imData->getDisplayY();
+        imData->frameCacheNeedsCleanup = false;
        #if defined(DGL_USE_GLES2) || defined(DGL_USE_GLES3) || defined(DGL_USE_OPENGL3)
-        ImGui_ImplOpenGL3_RenderDrawData(data);
+        ImGui_ImplOpenGL3_DestroyCache();
        #else
-        ImGui_ImplOpenGL2_RenderDrawData(data);
+        ImGui_ImplOpenGL2_DestroyCache();
        #endif
     }
 
+    const bool gpuTimer = imData->profiling && imData->beginGpuTimer();
+
+    if (ImDrawData* const data = ImGui::GetDrawData())
+    {
+        data->DisplayPos.x = -imData->getDisplayX();
+        data->DisplayPos.y = imData->getDisplayY();
+
+        imData->numMergedDrawCommands = imData->drawCommandMerging ? imData->mergeDrawCommands(data) : 0;
+
+        ImU32 fingerprint;
+        if ((imData->frameCaching || imData->renderToTexture)
+            && imData->getDrawDataFingerprint(data, fingerprint, imData->drawListStates))
+        {
+            // re-render only if something changed, otherwise just composite the previous result again
+            const bool changed = !imData->hasLastFingerprint || imData->lastFingerprint != fingerprint;
+
+            // when changes are limited to some windows, only their region of the cached frame is rendered again
+            const bool partial = changed && imData->hasLastFingerprint;
+            const ImVec4 damage(partial ? imData->getDamageRect() : ImVec4());
+
+            imData->hasLastFingerprint = true;
+            imData->lastFingerprint = fingerprint;
+            imData->lastDrawListStates.swap(imData->drawListStates);
+
+           #if defined(DGL_USE_GLES2) || defined(DGL_USE_GLES3) || defined(DGL_USE_OPENGL3)
+            if (changed || ! ImGui_ImplOpenGL3_RenderCachedDrawData(data))
+                ImGui_ImplOpenGL3_RenderDrawDataToCache(data, partial ? &damage : nullptr);
+           #else
+            if (changed || ! ImGui_ImplOpenGL2_RenderCachedDrawData(data))
+                ImGui_ImplOpenGL2_RenderDrawDataToCache(data, partial ? &damage : nullptr);
+           #endif
+        }
+        else
+        {
+            imData->hasLastFingerprint = false;
+
+           #if defined(DGL_USE_GLES2) || defined(DGL_USE_GLES3) || defined(DGL_USE_OPENGL3)
+            ImGui_ImplOpenGL3_RenderDrawData(data);
+           #else
+            ImGui_ImplOpenGL2_RenderDrawData(data);
+           #endif
+        }
+    }
+
+    if (gpuTimer)
+        imData->endGpuTimer();
+
    #ifdef DGL_USE_OPENGL3
     glUseProgram(gl3context.program);
    #endif
+
+    if (imData->profiling)
+    {
+        imData->addFrameStats(imData->lastFrameTime, newFrameEndTime, displayEndTime, renderEndTime,
+                              textureUploadsBefore, ImGui::GetDrawData());
+        imData->updateGpuTimes();
+    }
+
+    imData->updateAverageFrameTime(imData->getTime() - imData->lastFrameTime);
 }
 
 template <class BaseWidget>
@@ -270,9 +1298,11 @@ bool ImGuiWidget<BaseWidget>::onKeyboard(const Widget::KeyboardEvent& event)
         return true;
 
     ImGui::SetCurrentContext(imData->context);
+    imData->scheduleFrames(kNumFramesAfterEvent);
 
     ImGuiIO& io(ImGui::GetIO());
     imData->handleModifiers(io, event.mod);
+    imData->flushPointerInput(io);
 
     // d_stdout("onKeyboard %u %u %u", event.key, event.mod, event.keycode);
 
@@ -415,9 +1445,11 @@ bool ImGuiWidget<BaseWidget>::onCharacterInput(const Widget::CharacterInputEvent
         return true;
 
     ImGui::SetCurrentContext(imData->context);
+    imData->scheduleFrames(kNumFramesAfterEvent);
 
     ImGuiIO& io(ImGui::GetIO());
     imData->handleModifiers(io, event.mod);
+    imData->flushPointerInput(io);
 
     // d_stdout("input %u %u %lu '%s'", event.keycode, event.character, std::strlen(event.string), event.string);
 
@@ -432,6 +1464,7 @@ bool ImGuiWidget<BaseWidget>::onMouse(const Widget::MouseEvent& event)
         return true;
 
     ImGui::SetCurrentContext(imData->context);
+    imData->scheduleFrames(kNumFramesAfterEvent);
 
     ImGuiIO& io(ImGui::GetIO());
     imData->handleModifiers(io, event.mod);
@@ -445,6 +1478,8 @@ bool ImGuiWidget<BaseWidget>::onMouse(const Widget::MouseEvent& event)
     default: return false;
     }
 
+    // button edges must see the exact pointer position they happened at
+    imData->flushPointerInput(io);
     io.AddMouseButtonEvent(button, event.press);
     return io.WantCaptureMouse;
 }
@@ -456,11 +1491,12 @@ bool ImGuiWidget<BaseWidget>::onMotion(const Widget::MotionEvent& event)
         return true;
 
     ImGui::SetCurrentContext(imData->context);
+    imData->scheduleFrames(kNumFramesAfterEvent);
 
     ImGuiIO& io(ImGui::GetIO());
     imData->handleModifiers(io, event.mod);
 
-    io.AddMousePosEvent(event.pos.getX(), event.pos.getY());
+    imData->queueMousePos(event.pos.getX(), event.pos.getY());
     return false;
 }
 
@@ -471,11 +1507,12 @@ bool ImGuiWidget<BaseWidget>::onScroll(const Widget::ScrollEvent& event)
         return true;
 
     ImGui::SetCurrentContext(imData->context);
+    imData->scheduleFrames(kNumFramesAfterEvent);
 
     ImGuiIO& io(ImGui::GetIO());
     imData->handleModifiers(io, event.mod);
 
-    io.AddMouseWheelEvent(event.delta.getX(), event.delta.getY());
+    imData->queueMouseWheel(event.delta.getX(), event.delta.getY());
     return io.WantCaptureMouse;
 }
 
@@ -485,6 +1522,10 @@ void ImGuiWidget<BaseWidget>::onResize(const Widget::ResizeEvent& event)
     BaseWidget::onResize(event);
 
     ImGui::SetCurrentContext(imData->context);
+    imData->scheduleFrames(kNumFramesAfterEvent);
+
+    // the previous frame no longer fits
+    imData->hasLastFingerprint = false;
 
     ImGuiIO& io(ImGui::GetIO());
     io.DisplaySize.x = event.size.getWidth();
@@ -517,7 +1558,7 @@ ImGuiWidget<SubWidget>::ImGuiWidget(Widget* const parent, const float fontSize)
     : SubWidget(parent),
       imData(new PrivateData(this, fontSize))
 {
-    getWindow().addIdleCallback(this, 1000 / 60); // 60 fps
+    getWindow().addIdleCallback(this, 1000 / kDefaultFrameRate);
 }
 
 template <>
@@ -555,7 +1596,7 @@ ImGuiWidget<TopLevelWidget>::ImGuiWidget(Window& windowToMapTo, const float font
     : TopLevelWidget(windowToMapTo),
       imData(new PrivateData(this, fontSize))
 {
-    addIdleCallback(this, 1000 / 60); // 60 fps
+    addIdleCallback(this, 1000 / kDefaultFrameRate);
 }
 
 template <>
@@ -593,7 +1634,7 @@ ImGuiWidget<StandaloneWindow>::ImGuiWidget(Application& app, const float fontSiz
     : StandaloneWindow(app),
       imData(new PrivateData(this, fontSize))
 {
-    Window::addIdleCallback(this, 1000 / 60); // 60 fps
+    Window::addIdleCallback(this, 1000 / kDefaultFrameRate);
 }
 
 template <>
@@ -601,7 +1642,7 @@ ImGuiWidget<StandaloneWindow>::ImGuiWidget(Application& app, Window& transientPa
     : StandaloneWindow(app, transientParentWindow),
       imData(new PrivateData(this, fontSize))
 {
-    Window::addIdleCallback(this, 1000 / 60); // 60 fps
+    Window::addIdleCallback(this, 1000 / kDefaultFrameRate);
 }
 
 template <>
@@ -84,9 +84,188 @@ public:
 
    /**
       Change global font size.
+      Font atlases are shared between widgets and recently used sizes are kept around,
+      so going back to a previous font size or scale factor does not rebuild anything.
     */
     void setFontSize(float fontSize);
 
+   /**
+      Enable or disable render-on-demand mode.
+
+      By default a new frame is rendered on every idle tick, regardless of anything having changed.
+      When render-on-demand is enabled, frames are only rendered after input events, calls to invalidate(),
+      or while Dear ImGui still has pending work to do (e.g. text cursor blinking, open popups, navigation).
+      Once the UI becomes idle no more frames are rendered.
+    */
+    void setRenderOnDemand(bool renderOnDemand);
+
+   /**
+      Request a new frame to be rendered on the next idle tick.
+      Only needed in render-on-demand mode, when something displayed by onImGuiDisplay() changed outside of ImGui,
+      or when frame caching is enabled and the contents of a user texture changed.
+      @see setRenderOnDemand
+      @see setFrameCaching
+    */
+    void invalidate();
+
+   /**
+      Set the target frame rate, in frames per second.
+      The default is 60 fps.
+      @note This re-registers the widget idle callback, so it must not be called from within an idle callback.
+    */
+    void setTargetFrameRate(uint frameRate);
+
+   /**
+      Set the frame rate to use while the window does not have keyboard focus.
+      A value of 0 (the default) keeps using the target frame rate.
+      @see setFocused
+    */
+    void setUnfocusedFrameRate(uint frameRate);
+
+   /**
+      Set the frame time budget, in milliseconds.
+      When the average time spent rendering a frame goes over this budget,
+      the frame rate is lowered proportionally until frames become cheap enough again.
+      A value of 0 (the default) disables this.
+    */
+    void setFrameTimeBudget(double milliseconds);
+
+   /**
+      Let this widget know if its window has keyboard focus or not.
+      This is used for the unfocused frame rate and to let ImGui know when keyboard input is lost.
+      Call this from Window::onFocus() or UI::uiFocus(), as DGL does not send focus events to widgets.
+      @see setUnfocusedFrameRate
+    */
+    void setFocused(bool focused);
+
+   /**
+      Enable or disable frame caching.
+      When enabled, ImGui output is rendered into an offscreen framebuffer which is composited again as-is
+      for as long as the generated draw data does not change, skipping all rendering work on the GPU side.
+      When it does change, only the region covered by the windows that changed is rendered again.
+      Changes to the contents of user textures (as shown via ImGui::Image()) are not detected,
+      call invalidate() after updating them.
+    */
+    void setFrameCaching(bool frameCaching);
+
+   /**
+      Enable or disable render-to-texture mode, mostly useful for ImGuiSubWidget.
+      When enabled, ImGui output is rendered into an offscreen texture (same as with frame caching),
+      and repaints not triggered by this widget (e.g. the parent widget or window redrawing) only composite that texture.
+      A new ImGui frame is only generated on this widget idle ticks (subject to render-on-demand) or after invalidate().
+      Draw data containing user callbacks cannot be cached, and is always rendered directly.
+      @see setFrameCaching
+    */
+    void setRenderToTexture(bool renderToTexture);
+
+   /**
+      Enable or disable merging of draw commands before rendering.
+      When enabled, consecutive draw commands of a window that use the same texture are merged into a single draw call
+      if their clip rectangles are identical or have no effect on what is drawn, as it often happens with custom widgets.
+      This costs a pass over the indices of the draw data on the CPU side, the result on screen stays the same.
+      The number of draw calls before and after merging is available in the profiling statistics.
+      @see setProfiling
+    */
+    void setDrawCommandMerging(bool drawCommandMerging);
+
+   /**
+      Set a directory for keeping compiled shaders between sessions, or nullptr to not use one (the default).
+      Compiled shaders are always shared by all widgets of the same process,
+      this allows to skip shader compilation the next time a window is opened in a new process too.
+      This is a global setting, and has no effect on OpenGL 2.x or when the driver does not support retrieving shader binaries.
+    */
+    void setShaderCacheDirectory(const char* path);
+
+   /**
+      Create a texture for user images, to be shown with ImGui::Image().
+      Pixels are in RGBA format and start fully transparent, the texture repeats outside of the [0, 1] coordinate range.
+      This must be called while the OpenGL context is active, for example from the constructor or onImGuiDisplay().
+      @see updateTexture
+    */
+    ImTextureID createTexture(uint width, uint height);
+
+   /**
+      Update a region of a texture created with createTexture().
+      The pixels are copied right away, and only uploaded to the GPU on the next frame together with all other texture changes
+      (asynchronously through pixel buffer objects where available), so this does not block on the GPU
+      and can also be called outside of onImGuiDisplay().
+      Stride is the size of each row of pixels in bytes, 0 means rows are tightly packed.
+      A new frame is requested as if invalidate() had been called.
+
+      Uploads happen in full texture rows, so scrolling displays (like spectrograms) should only change the new row
+      and offset the texture coordinates given to ImGui::Image() instead of moving all pixels, costing a single row upload per frame.
+    */
+    void updateTexture(ImTextureID texture, uint x, uint y, uint width, uint height, const void* pixels, uint stride = 0);
+
+   /**
+      Destroy a texture created with createTexture().
+      This must be called while the OpenGL context is active, textures still around are destroyed together with the widget.
+    */
+    void destroyTexture(ImTextureID texture);
+
+   /**
+      Get the number of motion events merged into a previous one so far.
+      Consecutive motion events are coalesced into a single ImGui mouse position update per frame,
+      scroll events are coalesced by adding their deltas together.
+      Pending motion and scroll is always sent before mouse buttons, keys and modifiers,
+      so the order of button presses and releases relative to the pointer position stays exact.
+    */
+    uint getNumMergedMotionEvents() const noexcept;
+
+   /**
+      Get the number of scroll events merged into a previous one so far.
+      @see getNumMergedMotionEvents
+    */
+    uint getNumMergedScrollEvents() const noexcept;
+
+   /**
+      Statistics of a single frame, as recorded while profiling is enabled.
+      Times are wall-clock times in milliseconds, counts are for the draw data generated in that frame.
+    */
+    struct FrameStats {
+        /** Time spent in the backend and ImGui::NewFrame(). */
+        double newFrameTime;
+        /** Time spent in onImGuiDisplay(). */
+        double displayTime;
+        /** Time spent in ImGui::Render(). */
+        double renderTime;
+        /** Time spent submitting draw data to OpenGL. */
+        double renderDrawDataTime;
+        /**
+           Time spent by the GPU on the draw data, as measured by OpenGL timer queries.
+           Measurements become available a few frames later, until then (or if timer queries are not supported) this is -1.
+         */
+        double gpuTime;
+        uint drawLists;
+        /** Number of draw commands as generated by ImGui. */
+        uint drawCommands;
+        /** Number of draw commands left after merging, the same as drawCommands if merging is disabled. */
+        uint drawCalls;
+        uint vertices;
+        uint indices;
+        uint textureUploads;
+    };
+
+   /**
+      Enable or disable per-frame profiling.
+      While enabled, the statistics of the most recent frames are kept around and can be read with getFrameStats().
+      An overlay with averaged values can optionally be shown on top of the widget contents.
+      Frames that only composite a previously rendered texture are not recorded.
+    */
+    void setProfiling(bool profiling, bool showOverlay = false);
+
+   /**
+      Get the number of frames for which statistics are available.
+    */
+    uint getNumFrameStats() const noexcept;
+
+   /**
+      Get the statistics of a recent frame, where index 0 is the most recent one.
+      Returns false if index is out of range.
+      @see getNumFrameStats
+    */
+    bool getFrameStats(uint index, FrameStats& stats) const noexcept;
+
 protected:
    /**
       New virtual onDisplay function.
@@ -118,6 +118,33 @@
 // Read about ImGuiBackendFlags_RendererHasVtxOffset for details.
 //#define ImDrawIdx unsigned int
 
+//---- DPF: Use a compact 12 bytes vertex layout instead of the default 20 bytes one, to reduce vertex bandwidth.
+// Positions are stored with 1/4 pixel precision and texture coordinates are limited to the -1 to 1 range, see ImDrawVert in imgui.h.
+// Only the DPF OpenGL backends support it. Must be defined for every file including imgui.h, so better set it as a compiler flag.
+//#define IMGUI_DPF_COMPACT_DRAWVERT
+
+//---- DPF: Use a hash map for ImGuiStorage (e.g. tree node and window state) instead of a sorted array, making insertions O(1) instead of O(n).
+// Storage contents (ImGuiStorage::Data) are then kept in insertion order, unless sorted with BuildSortByKey(). Costs an extra index of 8 bytes per slot.
+//#define IMGUI_DPF_STORAGE_HASH_MAP
+
+//---- DPF: Don't check for CRC32c instructions (SSE 4.2 or ARMv8 CRC) at runtime, always hash IDs with the lookup table (hash values are the same either way).
+//#define IMGUI_DPF_DISABLE_CRC32_DISPATCH
+
+//---- DPF: Don't use SSE/NEON for computing normals and writing vertices of anti-aliased polylines and filled polygons (output is the same either way).
+// Only used with the default ImDrawVert layout, on x86 with SSE and on ARM64 when IMGUI_DPF_ENABLE_SIMD_DRAW_NEON is defined.
+//#define IMGUI_DPF_DISABLE_SIMD_TESSELLATION
+
+//---- DPF: Use NEON on ARM64 for SIMD tessellation and text (see IMGUI_DPF_DISABLE_SIMD_TESSELLATION and IMGUI_DPF_DISABLE_SIMD_TEXT), not enabled by default as it has not been verified on ARM64 hardware yet.
+// Run 'make run-simd-compare' in tests/ to check that output is the same as without SIMD.
+//#define IMGUI_DPF_ENABLE_SIMD_DRAW_NEON
+
+//---- DPF: Don't use SSE/NEON for writing glyph quads of text without word wrapping (output is the same either way).
+//#define IMGUI_DPF_DISABLE_SIMD_TEXT
+
+//---- DPF: Cache results of ImFont::CalcTextSizeA() (and so ImGui::CalcTextSize()), so that text measured in previous frames is not measured again.
+// Uses a fixed table of 2048 entries (about 80 KB) shared by all fonts, hit rate statistics are available from ImFontTextSizeCacheGetStats() in imgui_internal.h.
+//#define IMGUI_DPF_TEXT_SIZE_CACHE
+
 //---- Override ImDrawCallback signature (will need to modify renderer backends accordingly)
 //struct ImDrawList;
 //struct ImDrawCmd;
@@ -2229,6 +2229,126 @@ static const ImU32 GCrc32LookupTable[256] =
 };
 #endif
 
+// DPF: use CRC32c instructions (SSE 4.2 or ARMv8 CRC) when the CPU we run on has them, checked once on first use.
+// They compute the same values as the CRC32c table above, so IDs and .ini data are the same whichever path is taken.
+#if defined(IMGUI_DPF_BACKEND) && !defined(IMGUI_ENABLE_SSE4_2_CRC) && !defined(IMGUI_USE_LEGACY_CRC32_ADLER) && !defined(IMGUI_DPF_DISABLE_CRC32_DISPATCH)
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && !defined(__EMSCRIPTEN__)
+#define IMGUI_DPF_CRC32_DISPATCH
+#define IMGUI_DPF_CRC32_TARGET  __attribute__((target("sse4.2")))
+#include <nmmintrin.h>
+#elif (defined(_M_X64) || defined(_M_IX86)) && defined(_MSC_VER)
+#define IMGUI_DPF_CRC32_DISPATCH
+#ifdef __clang__
+#define IMGUI_DPF_CRC32_TARGET  __attribute__((target("sse4.2")))
+#else
+#define IMGUI_DPF_CRC32_TARGET
+#endif
+#include <nmmintrin.h>
+#include <intrin.h>     // __cpuid
+#elif defined(__aarch64__) && (defined(__ARM_FEATURE_CRC32) || (defined(__linux__) && defined(__GNUC__)))
+#define IMGUI_DPF_CRC32_DISPATCH
+#include <arm_acle.h>
+#if defined(__ARM_FEATURE_CRC32)
+#define IMGUI_DPF_CRC32_TARGET
+#elif defined(__clang__)
+#define IMGUI_DPF_CRC32_TARGET  __attribute__((target("crc")))
+#else
+#define IMGUI_DPF_CRC32_TARGET  __attribute__((target("+crc")))
+#endif
+#ifndef __ARM_FEATURE_CRC32
+#include <sys/auxv.h>   // getauxval
+#ifndef HWCAP_CRC32
+#define HWCAP_CRC32 (1 << 7)
+#endif
+#endif
+#endif
+#endif
+
+#ifdef IMGUI_DPF_CRC32_DISPATCH
+static bool ImHashCheckHardwareCrc32()
+{
+#if defined(_MSC_VER) && !defined(__aarch64__)
+    int cpu_info[4];
+    __cpuid(cpu_info, 1);
+    return (cpu_info[2] & (1 << 20)) != 0;
+#elif defined(__x86_64__) || defined(__i386__)
+    __builtin_cpu_init(); // Might be called from static constructors, before the compiler runtime did it
+    return __builtin_cpu_supports("sse4.2") != 0;
+#elif defined(__ARM_FEATURE_CRC32)
+    return true;
+#else
+    return (getauxval(AT_HWCAP) & HWCAP_CRC32) != 0;
+#endif
+}
+
+static inline bool ImHashHasHardwareCrc32()
+{
+    static const bool has_hardware_crc32 = ImHashCheckHardwareCrc32();
+    return has_hardware_crc32;
+}
+
+IMGUI_DPF_CRC32_TARGET static inline ImU32 ImHashCrc32U8(ImU32 crc, unsigned char v)
+{
+#ifdef __aarch64__
+    return __crc32cb(crc, v);
+#else
+    return _mm_crc32_u8(crc, v);
+#endif
+}
+
+IMGUI_DPF_CRC32_TARGET static inline ImU32 ImHashCrc32U64(ImU32 crc, ImU64 v)
+{
+#if defined(__aarch64__)
+    return __crc32cd(crc, v);
+#elif defined(__x86_64__) || defined(_M_X64)
+    return (ImU32)_mm_crc32_u64(crc, v);
+#else
+    return _mm_crc32_u32(_mm_crc32_u32(crc, (ImU32)v), (ImU32)(v >> 32));
+#endif
+}
+
+IMGUI_DPF_CRC32_TARGET static ImU32 ImHashDataHardwareCrc32(const unsigned char* data, size_t data_size, ImU32 crc)
+{
+    for (; data_size >= 8; data += 8, data_size -= 8)
+    {
+        ImU64 v;
+        memcpy(&v, data, 8);
+        crc = ImHashCrc32U64(crc, v);
+    }
+    for (; data_size != 0; data_size--)
+        crc = ImHashCrc32U8(crc, *data++);
+    return crc;
+}
+
+// Same as the ImHashStr() loop below, but hashing 8 bytes at once for as long as they contain no '#'
+IMGUI_DPF_CRC32_TARGET static ImU32 ImHashStrHardwareCrc32(const unsigned char* data, size_t data_size, ImU32 seed)
+{
+    ImU32 crc = seed;
+    while (data_size != 0)
+    {
+        if (data_size >= 8)
+        {
+            ImU64 v;
+            memcpy(&v, data, 8);
+            const ImU64 x = v ^ 0x2323232323232323ULL;
+            if (((x - 0x0101010101010101ULL) & ~x & 0x8080808080808080ULL) == 0)
+            {
+                crc = ImHashCrc32U64(crc, v);
+                data += 8;
+                data_size -= 8;
+                continue;
+            }
+        }
+        unsigned char c = *data++;
+        data_size--;
+        if (c == '#' && data_size >= 2 && data[0] == '#' && data[1] == '#')
+            crc = seed;
+        crc = ImHashCrc32U8(crc, c);
+    }
+    return crc;
+}
+#endif
+
 // Known size hash
 // It is ok to call ImHashData on a string with known length but the ### operator won't be supported.
 // FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
@@ -2238,6 +2358,10 @@ ImGuiID ImHashData(const void* data_p, size_t data_size, ImGuiID seed)
     const unsigned char* data = (const unsigned char*)data_p;
     const unsigned char *data_end = (const unsigned char*)data_p + data_size;
 #ifndef IMGUI_ENABLE_SSE4_2_CRC
+#ifdef IMGUI_DPF_CRC32_DISPATCH
+    if (ImHashHasHardwareCrc32())
+        return ~ImHashDataHardwareCrc32(data, data_size, crc);
+#endif
     const ImU32* crc32_lut = GCrc32LookupTable;
     while (data < data_end)
         crc = (crc >> 8) ^ crc32_lut[(crc & 0xFF) ^ *data++];
@@ -2265,6 +2389,10 @@ ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
     seed = ~seed;
     ImU32 crc = seed;
     const unsigned char* data = (const unsigned char*)data_p;
+#ifdef IMGUI_DPF_CRC32_DISPATCH
+    if (ImHashHasHardwareCrc32())
+        return ~ImHashStrHardwareCrc32(data, data_size != 0 ? data_size : strlen(data_p), seed);
+#endif
 #ifndef IMGUI_ENABLE_SSE4_2_CRC
     const ImU32* crc32_lut = GCrc32LookupTable;
 #endif
@@ -2703,6 +2831,7 @@ static int IMGUI_CDECL PairComparerByID(const void* lhs, const void* rhs)
     return (lhs_v > rhs_v ? +1 : lhs_v < rhs_v ? -1 : 0);
 }
 
+#ifndef IMGUI_DPF_STORAGE_HASH_MAP
 // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
 void ImGuiStorage::BuildSortByKey()
 {
@@ -2800,6 +2929,139 @@ void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
     else
         it->val_p = val;
 }
+#else
+// DPF: Hash map variant, Data is appended to and _Index maps keys to their position in Data (open addressing, linear probing).
+// The index has a power of two size of at least twice the number of pairs, so probe sequences stay short.
+static inline int ImGuiStorage_HashSlot(ImGuiID key, int mask)
+{
+    const ImU32 h = key * 0x9E3779B1u; // Keys are usually hashes already, but may also be plain indices
+    return (int)((h ^ (h >> 16)) & (ImU32)mask);
+}
+
+static void ImGuiStorage_InsertSlot(ImGuiStorage* storage, ImGuiID key, int index)
+{
+    const int mask = storage->_Index.Size - 1;
+    int slot = ImGuiStorage_HashSlot(key, mask);
+    while (storage->_Index.Data[slot].index != -1)
+        slot = (slot + 1) & mask;
+    storage->_Index.Data[slot].key = key;
+    storage->_Index.Data[slot].index = index;
+}
+
+static void ImGuiStorage_RebuildIndex(ImGuiStorage* storage)
+{
+    int size = 16;
+    while (size < storage->Data.Size * 2)
+        size *= 2;
+    storage->_Index.resize(size);
+    for (ImGuiStorageSlot& slot : storage->_Index)
+        slot.index = -1;
+    for (int n = 0; n < storage->Data.Size; n++)
+        ImGuiStorage_InsertSlot(storage, storage->Data.Data[n].key, n);
+    storage->_IndexedCount = storage->Data.Size;
+}
+
+static ImGuiStoragePair* ImGuiStorage_Find(const ImGuiStorage* storage, ImGuiID key)
+{
+    if (storage->Data.Size == 0)
+        return NULL;
+    if (storage->_IndexedCount != storage->Data.Size)
+        ImGuiStorage_RebuildIndex(const_cast<ImGuiStorage*>(storage));
+    const int mask = storage->_Index.Size - 1;
+    for (int slot = ImGuiStorage_HashSlot(key, mask); storage->_Index.Data[slot].index != -1; slot = (slot + 1) & mask)
+        if (storage->_Index.Data[slot].key == key)
+            return &storage->Data.Data[storage->_Index.Data[slot].index];
+    return NULL;
+}
+
+static ImGuiStoragePair* ImGuiStorage_FindOrAdd(ImGuiStorage* storage, const ImGuiStoragePair& new_pair)
+{
+    if (ImGuiStoragePair* it = ImGuiStorage_Find(storage, new_pair.key))
+        return it;
+    storage->Data.push_back(new_pair);
+    if (storage->_IndexedCount != storage->Data.Size - 1 || storage->Data.Size * 2 > storage->_Index.Size)
+    {
+        ImGuiStorage_RebuildIndex(storage);
+    }
+    else
+    {
+        ImGuiStorage_InsertSlot(storage, new_pair.key, storage->Data.Size - 1);
+        storage->_IndexedCount = storage->Data.Size;
+    }
+    return &storage->Data.back();
+}
+
+// Sorting is not needed for lookups here, but keeps the contents in the same order as the default implementation
+void ImGuiStorage::BuildSortByKey()
+{
+    ImQsort(Data.Data, (size_t)Data.Size, sizeof(ImGuiStoragePair), PairComparerByID);
+    ImGuiStorage_RebuildIndex(this);
+}
+
+int ImGuiStorage::GetInt(ImGuiID key, int default_val) const
+{
+    ImGuiStoragePair* it = ImGuiStorage_Find(this, key);
+    return it ? it->val_i : default_val;
+}
+
+bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
+{
+    return GetInt(key, default_val ? 1 : 0) != 0;
+}
+
+float ImGuiStorage::GetFloat(ImGuiID key, float default_val) const
+{
+    ImGuiStoragePair* it = ImGuiStorage_Find(this, key);
+    return it ? it->val_f : default_val;
+}
+
+void* ImGuiStorage::GetVoidPtr(ImGuiID key) const
+{
+    ImGuiStoragePair* it = ImGuiStorage_Find(this, key);
+    return it ? it->val_p : NULL;
+}
+
+// References are only valid until a new value is added to the storage. Calling a Set***() function or a Get***Ref() function invalidates the pointer.
+int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
+{
+    return &ImGuiStorage_FindOrAdd(this, ImGuiStoragePair(key, default_val))->val_i;
+}
+
+bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
+{
+    return (bool*)GetIntRef(key, default_val ? 1 : 0);
+}
+
+float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
+{
+    return &ImGuiStorage_FindOrAdd(this, ImGuiStoragePair(key, default_val))->val_f;
+}
+
+void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
+{
+    return &ImGuiStorage_FindOrAdd(this, ImGuiStoragePair(key, default_val))->val_p;
+}
+
+void ImGuiStorage::SetInt(ImGuiID key, int val)
+{
+    ImGuiStorage_FindOrAdd(this, ImGuiStoragePair(key, val))->val_i = val;
+}
+
+void ImGuiStorage::SetBool(ImGuiID key, bool val)
+{
+    SetInt(key, val ? 1 : 0);
+}
+
+void ImGuiStorage::SetFloat(ImGuiID key, float val)
+{
+    ImGuiStorage_FindOrAdd(this, ImGuiStoragePair(key, val))->val_f = val;
+}
+
+void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
+{
+    ImGuiStorage_FindOrAdd(this, ImGuiStoragePair(key, val))->val_p = val;
+}
+#endif
 
 void ImGuiStorage::SetAllInt(int v)
 {
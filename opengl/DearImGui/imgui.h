@@ -2621,6 +2621,15 @@ struct ImGuiStoragePair
     ImGuiStoragePair(ImGuiID _key, void* _val)  { key = _key; val_p = _val; }
 };
 
+#ifdef IMGUI_DPF_STORAGE_HASH_MAP
+// [Internal] DPF: Slot of the ImGuiStorage hash index, 'index' is the position of the pair in ImGuiStorage::Data or -1 for empty slots
+struct ImGuiStorageSlot
+{
+    ImGuiID     key;
+    int         index;
+};
+#endif
+
 // Helper: Key->Value storage
 // Typically you don't have to worry about this since a storage is held within each Window.
 // We use it to e.g. store collapse state for a tree (Int 0/1)
@@ -2633,11 +2642,22 @@ struct ImGuiStorage
 {
     // [Internal]
     ImVector<ImGuiStoragePair>      Data;
+#ifdef IMGUI_DPF_STORAGE_HASH_MAP
+    // [Internal] DPF: Data is kept in insertion order and looked up through an open addressing hash index, see imconfig.h.
+    // The index is rebuilt on next use whenever the size of Data was changed directly (or _IndexedCount set to -1), and by BuildSortByKey().
+    ImVector<ImGuiStorageSlot>      _Index;
+    int                             _IndexedCount;
+    ImGuiStorage() { _IndexedCount = 0; }
+#endif
 
     // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N)
     // - Set***() functions find pair, insertion on demand if missing.
     // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair.
+#ifdef IMGUI_DPF_STORAGE_HASH_MAP
+    void                Clear() { Data.clear(); _Index.clear(); _IndexedCount = 0; }
+#else
     void                Clear() { Data.clear(); }
+#endif
     IMGUI_API int       GetInt(ImGuiID key, int default_val = 0) const;
     IMGUI_API void      SetInt(ImGuiID key, int val);
     IMGUI_API bool      GetBool(ImGuiID key, bool default_val = false) const;
@@ -3003,7 +3023,33 @@ struct ImDrawCmd
 };
 
 // Vertex layout
-#ifndef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
+#if defined(IMGUI_DPF_COMPACT_DRAWVERT) && !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+// DPF: compact vertex layout (12 bytes), only supported by the DPF OpenGL backends.
+// Positions are stored in fixed point with 1/IMGUI_DPF_DRAWVERT_POS_SCALE pixel steps (-8191.75 to +8191.75 range),
+// texture coordinates are stored as signed normalized values (-1 to +1 range). Values are converted when written and read back.
+#define IMGUI_DPF_DRAWVERT_POS_SCALE    4
+#define IMGUI_DPF_DRAWVERT_UV_SCALE     32767
+template<int SCALE>
+struct ImDrawVertFixed
+{
+    short   v;
+    ImDrawVertFixed& operator=(float f) { f *= SCALE; v = (short)(f >= 32767.0f ? 32767 : f <= -32767.0f ? -32767 : (int)(f >= 0.0f ? f + 0.5f : f - 0.5f)); return *this; }
+    operator float() const              { return (float)v / SCALE; }
+};
+template<int SCALE>
+struct ImDrawVertFixed2
+{
+    ImDrawVertFixed<SCALE> x, y;
+    ImDrawVertFixed2& operator=(const ImVec2& f) { x = f.x; y = f.y; return *this; }
+    operator ImVec2() const             { return ImVec2(x, y); }
+};
+struct ImDrawVert
+{
+    ImDrawVertFixed2<IMGUI_DPF_DRAWVERT_POS_SCALE>  pos;
+    ImDrawVertFixed2<IMGUI_DPF_DRAWVERT_UV_SCALE>   uv;
+    ImU32                                           col;
+};
+#elif !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImDrawVert
 {
     ImVec2  pos;
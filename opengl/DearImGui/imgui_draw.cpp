@@ -761,6 +761,167 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
 #define IM_FIXNORMAL2F_MAX_INVLEN2          100.0f // 500.0f (see #4053, #3366)
 #define IM_FIXNORMAL2F(VX,VY)               { float d2 = VX*VX + VY*VY; if (d2 > 0.000001f) { float inv_len2 = 1.0f / d2; if (inv_len2 > IM_FIXNORMAL2F_MAX_INVLEN2) inv_len2 = IM_FIXNORMAL2F_MAX_INVLEN2; VX *= inv_len2; VY *= inv_len2; } } (void)0
 
+// DPF: SSE/NEON versions of the normal computation and vertex emission loops of AddPolyline() and AddConvexPolyFilled(), 2 points at a time,
+// and of the glyph quad emission of ImFont::RenderText().
+// Operations are the same as in the scalar code, in the same order, so the output is the same too (ImRsqrt() uses the same instruction on SSE,
+// and on NEON both compute 1/sqrt(x) exactly). Only for the default ImDrawVert layout, as vertices are written as pos+uv and col pairs.
+// The NEON version is opt-in until verified on ARM64 hardware, see 'make run-simd-compare' in tests/.
+#if defined(IMGUI_DPF_BACKEND) && !defined(IMGUI_DPF_COMPACT_DRAWVERT) && !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+#if defined(IMGUI_ENABLE_SSE)
+#define IMGUI_DPF_SIMD_DRAW
+typedef __m128 ImDrawSimd4;
+static inline ImDrawSimd4 ImDrawSimd_Load4(const float* p)                  { return _mm_loadu_ps(p); }
+static inline ImDrawSimd4 ImDrawSimd_Load2(const ImVec2* p)                 { return _mm_loadu_ps(&p->x); }
+static inline ImDrawSimd4 ImDrawSimd_Load1(const ImVec2* p)                 { ImDrawSimd4 v = _mm_loadl_pi(_mm_setzero_ps(), (const __m64*)p); return _mm_movelh_ps(v, v); }
+static inline ImDrawSimd4 ImDrawSimd_Set(float x, float y)                  { return _mm_setr_ps(x, y, x, y); }
+static inline void        ImDrawSimd_Store2(ImVec2* p, ImDrawSimd4 v)       { _mm_storeu_ps(&p->x, v); }
+static inline ImDrawSimd4 ImDrawSimd_Add(ImDrawSimd4 a, ImDrawSimd4 b)      { return _mm_add_ps(a, b); }
+static inline ImDrawSimd4 ImDrawSimd_Sub(ImDrawSimd4 a, ImDrawSimd4 b)      { return _mm_sub_ps(a, b); }
+static inline ImDrawSimd4 ImDrawSimd_Mul(ImDrawSimd4 a, ImDrawSimd4 b)      { return _mm_mul_ps(a, b); }
+static inline ImDrawSimd4 ImDrawSimd_Min(ImDrawSimd4 a, ImDrawSimd4 b)      { return _mm_min_ps(a, b); }
+static inline ImDrawSimd4 ImDrawSimd_Rsqrt(ImDrawSimd4 a)                   { return _mm_rsqrt_ps(a); }
+static inline ImDrawSimd4 ImDrawSimd_Recip(ImDrawSimd4 a)                   { return _mm_div_ps(_mm_set1_ps(1.0f), a); }
+static inline ImDrawSimd4 ImDrawSimd_SwapXY(ImDrawSimd4 a)                  { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)); }
+static inline ImDrawSimd4 ImDrawSimd_NegY(ImDrawSimd4 a)                    { return _mm_xor_ps(a, _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f)); }
+static inline ImDrawSimd4 ImDrawSimd_SelectGt(ImDrawSimd4 a, ImDrawSimd4 b, ImDrawSimd4 if_gt, ImDrawSimd4 if_not) { ImDrawSimd4 m = _mm_cmpgt_ps(a, b); return _mm_or_ps(_mm_and_ps(m, if_gt), _mm_andnot_ps(m, if_not)); }
+static inline void        ImDrawSimd_WriteVtxLo(ImDrawVert* vtx, ImDrawSimd4 pos, ImDrawSimd4 uv, ImU32 col) { _mm_storeu_ps(&vtx->pos.x, _mm_movelh_ps(pos, uv)); vtx->col = col; }
+static inline void        ImDrawSimd_WriteVtxHi(ImDrawVert* vtx, ImDrawSimd4 pos, ImDrawSimd4 uv, ImU32 col) { _mm_storeu_ps(&vtx->pos.x, _mm_shuffle_ps(pos, uv, _MM_SHUFFLE(1, 0, 3, 2))); vtx->col = col; }
+static inline void        ImDrawSimd_WriteQuad(ImDrawVert* vtx, ImDrawSimd4 pos, ImDrawSimd4 uv, ImU32 col) // Same as PrimRectUV(), pos and uv are (x1, y1, x2, y2)
+{
+    _mm_storeu_ps(&vtx[0].pos.x, _mm_movelh_ps(pos, uv));                           vtx[0].col = col;
+    _mm_storeu_ps(&vtx[1].pos.x, _mm_shuffle_ps(pos, uv, _MM_SHUFFLE(1, 2, 1, 2))); vtx[1].col = col;
+    _mm_storeu_ps(&vtx[2].pos.x, _mm_movehl_ps(uv, pos));                           vtx[2].col = col;
+    _mm_storeu_ps(&vtx[3].pos.x, _mm_shuffle_ps(pos, uv, _MM_SHUFFLE(3, 0, 3, 0))); vtx[3].col = col;
+}
+#elif defined(IMGUI_DPF_ENABLE_SIMD_DRAW_NEON) && (defined(__aarch64__) || defined(_M_ARM64))
+#define IMGUI_DPF_SIMD_DRAW
+#include <arm_neon.h>
+typedef float32x4_t ImDrawSimd4;
+static inline ImDrawSimd4 ImDrawSimd_Load4(const float* p)                  { return vld1q_f32(p); }
+static inline ImDrawSimd4 ImDrawSimd_Load2(const ImVec2* p)                 { return vld1q_f32(&p->x); }
+static inline ImDrawSimd4 ImDrawSimd_Load1(const ImVec2* p)                 { float32x2_t v = vld1_f32(&p->x); return vcombine_f32(v, v); }
+static inline ImDrawSimd4 ImDrawSimd_Set(float x, float y)                  { const float v[4] = { x, y, x, y }; return vld1q_f32(v); }
+static inline void        ImDrawSimd_Store2(ImVec2* p, ImDrawSimd4 v)       { vst1q_f32(&p->x, v); }
+static inline ImDrawSimd4 ImDrawSimd_Add(ImDrawSimd4 a, ImDrawSimd4 b)      { return vaddq_f32(a, b); }
+static inline ImDrawSimd4 ImDrawSimd_Sub(ImDrawSimd4 a, ImDrawSimd4 b)      { return vsubq_f32(a, b); }
+static inline ImDrawSimd4 ImDrawSimd_Mul(ImDrawSimd4 a, ImDrawSimd4 b)      { return vmulq_f32(a, b); }
+static inline ImDrawSimd4 ImDrawSimd_Min(ImDrawSimd4 a, ImDrawSimd4 b)      { return vminq_f32(a, b); }
+static inline ImDrawSimd4 ImDrawSimd_Rsqrt(ImDrawSimd4 a)                   { return vdivq_f32(vdupq_n_f32(1.0f), vsqrtq_f32(a)); }
+static inline ImDrawSimd4 ImDrawSimd_Recip(ImDrawSimd4 a)                   { return vdivq_f32(vdupq_n_f32(1.0f), a); }
+static inline ImDrawSimd4 ImDrawSimd_SwapXY(ImDrawSimd4 a)                  { return vrev64q_f32(a); }
+static inline ImDrawSimd4 ImDrawSimd_NegY(ImDrawSimd4 a)                    { const uint32_t m[4] = { 0, 0x80000000, 0, 0x80000000 }; return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(a), vld1q_u32(m))); }
+static inline ImDrawSimd4 ImDrawSimd_SelectGt(ImDrawSimd4 a, ImDrawSimd4 b, ImDrawSimd4 if_gt, ImDrawSimd4 if_not) { return vbslq_f32(vcgtq_f32(a, b), if_gt, if_not); }
+static inline void        ImDrawSimd_WriteVtxLo(ImDrawVert* vtx, ImDrawSimd4 pos, ImDrawSimd4 uv, ImU32 col) { vst1q_f32(&vtx->pos.x, vcombine_f32(vget_low_f32(pos), vget_low_f32(uv))); vtx->col = col; }
+static inline void        ImDrawSimd_WriteVtxHi(ImDrawVert* vtx, ImDrawSimd4 pos, ImDrawSimd4 uv, ImU32 col) { vst1q_f32(&vtx->pos.x, vcombine_f32(vget_high_f32(pos), vget_low_f32(uv))); vtx->col = col; }
+static inline void        ImDrawSimd_WriteQuad(ImDrawVert* vtx, ImDrawSimd4 pos, ImDrawSimd4 uv, ImU32 col) // Same as PrimRectUV(), pos and uv are (x1, y1, x2, y2)
+{
+    const uint32_t m[4] = { 0xFFFFFFFF, 0, 0xFFFFFFFF, 0 };
+    const uint32x4_t mask_x = vld1q_u32(m);
+    const ImDrawSimd4 pos_x2y1_x1y2 = vbslq_f32(mask_x, vextq_f32(pos, pos, 2), pos);
+    const ImDrawSimd4 uv_x2y1_x1y2 = vbslq_f32(mask_x, vextq_f32(uv, uv, 2), uv);
+    vst1q_f32(&vtx[0].pos.x, vcombine_f32(vget_low_f32(pos), vget_low_f32(uv)));                         vtx[0].col = col;
+    vst1q_f32(&vtx[1].pos.x, vcombine_f32(vget_low_f32(pos_x2y1_x1y2), vget_low_f32(uv_x2y1_x1y2)));   vtx[1].col = col;
+    vst1q_f32(&vtx[2].pos.x, vcombine_f32(vget_high_f32(pos), vget_high_f32(uv)));                       vtx[2].col = col;
+    vst1q_f32(&vtx[3].pos.x, vcombine_f32(vget_high_f32(pos_x2y1_x1y2), vget_high_f32(uv_x2y1_x1y2))); vtx[3].col = col;
+}
+#endif
+#endif
+
+#if defined(IMGUI_DPF_SIMD_DRAW) && !defined(IMGUI_DPF_DISABLE_SIMD_TESSELLATION)
+#define IMGUI_DPF_SIMD_TESSELLATION
+#endif
+#if defined(IMGUI_DPF_SIMD_DRAW) && !defined(IMGUI_DPF_DISABLE_SIMD_TEXT)
+#define IMGUI_DPF_SIMD_TEXT
+#endif
+
+#ifdef IMGUI_DPF_SIMD_DRAW
+IM_STATIC_ASSERT(sizeof(ImDrawVert) == 20 && offsetof(ImDrawVert, uv) == 8 && offsetof(ImDrawVert, col) == 16);
+#endif
+
+#ifdef IMGUI_DPF_SIMD_TESSELLATION
+
+// Same as IM_NORMALIZE2F_OVER_ZERO() + 90 degrees rotation: normals[i] is the normal of the segment going from points[i] to points[i + 1],
+// the last segment going back to points[0] if count == points_count.
+static void ImDrawList_SimdCalcNormals(const ImVec2* points, const int points_count, const int count, ImVec2* normals)
+{
+    const ImDrawSimd4 zero = ImDrawSimd_Set(0.0f, 0.0f);
+    int i1 = 0;
+    for (; i1 + 2 < points_count && i1 + 2 <= count; i1 += 2)
+    {
+        ImDrawSimd4 d = ImDrawSimd_Sub(ImDrawSimd_Load2(&points[i1 + 1]), ImDrawSimd_Load2(&points[i1]));
+        ImDrawSimd4 d2 = ImDrawSimd_Mul(d, d);
+        d2 = ImDrawSimd_Add(d2, ImDrawSimd_SwapXY(d2));
+        d = ImDrawSimd_SelectGt(d2, zero, ImDrawSimd_Mul(d, ImDrawSimd_Rsqrt(d2)), d);
+        ImDrawSimd_Store2(&normals[i1], ImDrawSimd_NegY(ImDrawSimd_SwapXY(d)));
+    }
+    for (; i1 < count; i1++)
+    {
+        const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
+        float dx = points[i2].x - points[i1].x;
+        float dy = points[i2].y - points[i1].y;
+        IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+        normals[i1].x = dy;
+        normals[i1].y = -dx;
+    }
+}
+
+// Same as IM_FIXNORMAL2F()
+static inline ImDrawSimd4 ImDrawSimd_FixNormal(ImDrawSimd4 dm)
+{
+    ImDrawSimd4 d2 = ImDrawSimd_Mul(dm, dm);
+    d2 = ImDrawSimd_Add(d2, ImDrawSimd_SwapXY(d2));
+    ImDrawSimd4 inv_len2 = ImDrawSimd_Min(ImDrawSimd_Recip(d2), ImDrawSimd_Set(IM_FIXNORMAL2F_MAX_INVLEN2, IM_FIXNORMAL2F_MAX_INVLEN2));
+    return ImDrawSimd_SelectGt(d2, ImDrawSimd_Set(0.000001f, 0.000001f), ImDrawSimd_Mul(dm, inv_len2), dm);
+}
+
+// Write VTX_COUNT vertices for every point, offset along the averaged normal of its 2 segments by offsets[] (0.0f for the point itself).
+// For lines that are not closed, the first point uses the normal of the first segment as-is.
+template<int VTX_COUNT>
+static void ImDrawList_SimdWritePointVertices(ImDrawVert* vtx_write, const ImVec2* points, const ImVec2* normals, const int points_count, const bool closed, const float* offsets, const ImVec2* uvs, const ImU32* cols)
+{
+    ImDrawSimd4 offsets4[VTX_COUNT], uvs4[VTX_COUNT];
+    for (int n = 0; n < VTX_COUNT; n++)
+    {
+        offsets4[n] = ImDrawSimd_Set(offsets[n], offsets[n]);
+        uvs4[n] = ImDrawSimd_Set(uvs[n].x, uvs[n].y);
+    }
+    const ImDrawSimd4 half = ImDrawSimd_Set(0.5f, 0.5f);
+
+    // First point
+    {
+        ImDrawSimd4 dm = ImDrawSimd_Load1(&normals[0]);
+        if (closed)
+            dm = ImDrawSimd_FixNormal(ImDrawSimd_Mul(ImDrawSimd_Add(ImDrawSimd_Load1(&normals[points_count - 1]), dm), half));
+        const ImDrawSimd4 p = ImDrawSimd_Load1(&points[0]);
+        for (int n = 0; n < VTX_COUNT; n++)
+            ImDrawSimd_WriteVtxLo(&vtx_write[n], offsets[n] == 0.0f ? p : ImDrawSimd_Add(p, ImDrawSimd_Mul(dm, offsets4[n])), uvs4[n], cols[n]);
+    }
+
+    // Other points, 2 at a time
+    int i = 1;
+    for (; i + 1 < points_count; i += 2)
+    {
+        const ImDrawSimd4 dm = ImDrawSimd_FixNormal(ImDrawSimd_Mul(ImDrawSimd_Add(ImDrawSimd_Load2(&normals[i - 1]), ImDrawSimd_Load2(&normals[i])), half));
+        const ImDrawSimd4 p = ImDrawSimd_Load2(&points[i]);
+        ImDrawVert* vtx = &vtx_write[i * VTX_COUNT];
+        for (int n = 0; n < VTX_COUNT; n++)
+        {
+            const ImDrawSimd4 pos = offsets[n] == 0.0f ? p : ImDrawSimd_Add(p, ImDrawSimd_Mul(dm, offsets4[n]));
+            ImDrawSimd_WriteVtxLo(&vtx[n], pos, uvs4[n], cols[n]);
+            ImDrawSimd_WriteVtxHi(&vtx[n + VTX_COUNT], pos, uvs4[n], cols[n]);
+        }
+    }
+    if (i < points_count)
+    {
+        const ImDrawSimd4 dm = ImDrawSimd_FixNormal(ImDrawSimd_Mul(ImDrawSimd_Add(ImDrawSimd_Load1(&normals[i - 1]), ImDrawSimd_Load1(&normals[i])), half));
+        const ImDrawSimd4 p = ImDrawSimd_Load1(&points[i]);
+        ImDrawVert* vtx = &vtx_write[i * VTX_COUNT];
+        for (int n = 0; n < VTX_COUNT; n++)
+            ImDrawSimd_WriteVtxLo(&vtx[n], offsets[n] == 0.0f ? p : ImDrawSimd_Add(p, ImDrawSimd_Mul(dm, offsets4[n])), uvs4[n], cols[n]);
+    }
+}
+#endif // IMGUI_DPF_SIMD_TESSELLATION
+
 // TODO: Thickness anti-aliased lines cap are missing their AA fringe.
 // We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
 void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32 col, ImDrawFlags flags, float thickness)
@@ -798,11 +959,19 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
 
         // Temporary buffer
         // The first <points_count> items are normals at each line point, then after that there are either 2 or 4 temp points for each line point
+#ifdef IMGUI_DPF_SIMD_TESSELLATION
+        _Data->TempBuffer.reserve_discard(points_count); // DPF: Only normals, there are no temp points
+        ImVec2* temp_normals = _Data->TempBuffer.Data;
+#else
         _Data->TempBuffer.reserve_discard(points_count * ((use_texture || !thick_line) ? 3 : 5));
         ImVec2* temp_normals = _Data->TempBuffer.Data;
         ImVec2* temp_points = temp_normals + points_count;
+#endif
 
         // Calculate normals (tangents) for each line segment
+#ifdef IMGUI_DPF_SIMD_TESSELLATION
+        ImDrawList_SimdCalcNormals(points, points_count, count, temp_normals);
+#else
         for (int i1 = 0; i1 < count; i1++)
         {
             const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
@@ -812,6 +981,7 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             temp_normals[i1].x = dy;
             temp_normals[i1].y = -dx;
         }
+#endif
         if (!closed)
             temp_normals[points_count - 1] = temp_normals[points_count - 2];
 
@@ -828,6 +998,25 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             //   allow scaling geometry while preserving one-screen-pixel AA fringe).
             const float half_draw_size = use_texture ? ((thickness * 0.5f) + 1) : AA_SIZE;
 
+#ifdef IMGUI_DPF_SIMD_TESSELLATION
+            // DPF: Vertices are written directly from the normals, the loop below only adds indices
+            if (use_texture)
+            {
+                const ImVec4 tex_uvs = _Data->TexUvLines[integer_thickness];
+                const float offsets[2] = { half_draw_size, -half_draw_size };
+                const ImVec2 uvs[2] = { ImVec2(tex_uvs.x, tex_uvs.y), ImVec2(tex_uvs.z, tex_uvs.w) };
+                const ImU32 cols[2] = { col, col };
+                ImDrawList_SimdWritePointVertices<2>(_VtxWritePtr, points, temp_normals, points_count, closed, offsets, uvs, cols);
+            }
+            else
+            {
+                const float offsets[3] = { 0.0f, half_draw_size, -half_draw_size };
+                const ImVec2 uvs[3] = { opaque_uv, opaque_uv, opaque_uv };
+                const ImU32 cols[3] = { col, col_trans, col_trans };
+                ImDrawList_SimdWritePointVertices<3>(_VtxWritePtr, points, temp_normals, points_count, closed, offsets, uvs, cols);
+            }
+            _VtxWritePtr += vtx_count;
+#else
             // If line is not closed, the first and last points need to be generated differently as there are no normals to blend
             if (!closed)
             {
@@ -836,6 +1025,7 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 temp_points[(points_count-1)*2+0] = points[points_count-1] + temp_normals[points_count-1] * half_draw_size;
                 temp_points[(points_count-1)*2+1] = points[points_count-1] - temp_normals[points_count-1] * half_draw_size;
             }
+#endif
 
             // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
             // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
@@ -846,6 +1036,7 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1; // i2 is the second point of the line segment
                 const unsigned int idx2 = ((i1 + 1) == points_count) ? _VtxCurrentIdx : (idx1 + (use_texture ? 2 : 3)); // Vertex index for end of segment
 
+#ifndef IMGUI_DPF_SIMD_TESSELLATION
                 // Average normals
                 float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
                 float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
@@ -859,6 +1050,9 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 out_vtx[0].y = points[i2].y + dm_y;
                 out_vtx[1].x = points[i2].x - dm_x;
                 out_vtx[1].y = points[i2].y - dm_y;
+#else
+                IM_UNUSED(i2);
+#endif
 
                 if (use_texture)
                 {
@@ -880,6 +1074,7 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 idx1 = idx2;
             }
 
+#ifndef IMGUI_DPF_SIMD_TESSELLATION
             // Add vertexes for each point on the line
             if (use_texture)
             {
@@ -913,12 +1108,21 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                     _VtxWritePtr += 3;
                 }
             }
+#endif
         }
         else
         {
             // [PATH 2] Non texture-based lines (thick): we need to draw the solid line core and thus require four vertices per point
             const float half_inner_thickness = (thickness - AA_SIZE) * 0.5f;
 
+#ifdef IMGUI_DPF_SIMD_TESSELLATION
+            // DPF: Vertices are written directly from the normals, the loop below only adds indices
+            const float offsets[4] = { half_inner_thickness + AA_SIZE, half_inner_thickness, -half_inner_thickness, -(half_inner_thickness + AA_SIZE) };
+            const ImVec2 uvs[4] = { opaque_uv, opaque_uv, opaque_uv, opaque_uv };
+            const ImU32 cols[4] = { col_trans, col, col, col_trans };
+            ImDrawList_SimdWritePointVertices<4>(_VtxWritePtr, points, temp_normals, points_count, closed, offsets, uvs, cols);
+            _VtxWritePtr += vtx_count;
+#else
             // If line is not closed, the first and last points need to be generated differently as there are no normals to blend
             if (!closed)
             {
@@ -932,6 +1136,7 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 temp_points[points_last * 4 + 2] = points[points_last] - temp_normals[points_last] * (half_inner_thickness);
                 temp_points[points_last * 4 + 3] = points[points_last] - temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
             }
+#endif
 
             // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
             // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
@@ -942,6 +1147,7 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 const int i2 = (i1 + 1) == points_count ? 0 : (i1 + 1); // i2 is the second point of the line segment
                 const unsigned int idx2 = (i1 + 1) == points_count ? _VtxCurrentIdx : (idx1 + 4); // Vertex index for end of segment
 
+#ifndef IMGUI_DPF_SIMD_TESSELLATION
                 // Average normals
                 float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
                 float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
@@ -961,6 +1167,9 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 out_vtx[2].y = points[i2].y - dm_in_y;
                 out_vtx[3].x = points[i2].x - dm_out_x;
                 out_vtx[3].y = points[i2].y - dm_out_y;
+#else
+                IM_UNUSED(i2);
+#endif
 
                 // Add indexes
                 _IdxWritePtr[0]  = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[1]  = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[2]  = (ImDrawIdx)(idx1 + 2);
@@ -974,6 +1183,7 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 idx1 = idx2;
             }
 
+#ifndef IMGUI_DPF_SIMD_TESSELLATION
             // Add vertices
             for (int i = 0; i < points_count; i++)
             {
@@ -983,6 +1193,7 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 _VtxWritePtr[3].pos = temp_points[i * 4 + 3]; _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col_trans;
                 _VtxWritePtr += 4;
             }
+#endif
         }
         _VtxCurrentIdx += (ImDrawIdx)vtx_count;
     }
@@ -1049,6 +1260,15 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
         // Compute normals
         _Data->TempBuffer.reserve_discard(points_count);
         ImVec2* temp_normals = _Data->TempBuffer.Data;
+#ifdef IMGUI_DPF_SIMD_TESSELLATION
+        // DPF: Vertices are written directly from the normals, the loop below only adds indices
+        ImDrawList_SimdCalcNormals(points, points_count, points_count, temp_normals);
+        const float offsets[2] = { -(AA_SIZE * 0.5f), AA_SIZE * 0.5f };
+        const ImVec2 uvs[2] = { uv, uv };
+        const ImU32 cols[2] = { col, col_trans };
+        ImDrawList_SimdWritePointVertices<2>(_VtxWritePtr, points, temp_normals, points_count, true, offsets, uvs, cols);
+        _VtxWritePtr += vtx_count;
+#else
         for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
         {
             const ImVec2& p0 = points[i0];
@@ -1059,9 +1279,11 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
             temp_normals[i0].x = dy;
             temp_normals[i0].y = -dx;
         }
+#endif
 
         for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
         {
+#ifndef IMGUI_DPF_SIMD_TESSELLATION
             // Average normals
             const ImVec2& n0 = temp_normals[i0];
             const ImVec2& n1 = temp_normals[i1];
@@ -1075,6 +1297,7 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
             _VtxWritePtr[0].pos.x = (points[i1].x - dm_x); _VtxWritePtr[0].pos.y = (points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
             _VtxWritePtr[1].pos.x = (points[i1].x + dm_x); _VtxWritePtr[1].pos.y = (points[i1].y + dm_y); _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;  // Outer
             _VtxWritePtr += 2;
+#endif
 
             // Add indexes for fringes
             _IdxWritePtr[0] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1)); _IdxWritePtr[1] = (ImDrawIdx)(vtx_inner_idx + (i0 << 1)); _IdxWritePtr[2] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1));
@@ -2010,6 +2233,15 @@ void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_cou
         // Compute normals
         _Data->TempBuffer.reserve_discard(points_count);
         ImVec2* temp_normals = _Data->TempBuffer.Data;
+#ifdef IMGUI_DPF_SIMD_TESSELLATION
+        // DPF: Vertices are written directly from the normals, the loop below only adds indices
+        ImDrawList_SimdCalcNormals(points, points_count, points_count, temp_normals);
+        const float offsets[2] = { -(AA_SIZE * 0.5f), AA_SIZE * 0.5f };
+        const ImVec2 uvs[2] = { uv, uv };
+        const ImU32 cols[2] = { col, col_trans };
+        ImDrawList_SimdWritePointVertices<2>(_VtxWritePtr, points, temp_normals, points_count, true, offsets, uvs, cols);
+        _VtxWritePtr += vtx_count;
+#else
         for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
         {
             const ImVec2& p0 = points[i0];
@@ -2020,9 +2252,11 @@ void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_cou
             temp_normals[i0].x = dy;
             temp_normals[i0].y = -dx;
         }
+#endif
 
         for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
         {
+#ifndef IMGUI_DPF_SIMD_TESSELLATION
             // Average normals
             const ImVec2& n0 = temp_normals[i0];
             const ImVec2& n1 = temp_normals[i1];
@@ -2036,6 +2270,7 @@ void ImDrawList::AddConcavePolyFilled(const ImVec2* points, const int points_cou
             _VtxWritePtr[0].pos.x = (points[i1].x - dm_x); _VtxWritePtr[0].pos.y = (points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
             _VtxWritePtr[1].pos.x = (points[i1].x + dm_x); _VtxWritePtr[1].pos.y = (points[i1].y + dm_y); _VtxWritePtr[1].uv = uv; _VtxWritePtr[1].col = col_trans;  // Outer
             _VtxWritePtr += 2;
+#endif
 
             // Add indexes for fringes
             _IdxWritePtr[0] = (ImDrawIdx)(vtx_inner_idx + (i1 << 1)); _IdxWritePtr[1] = (ImDrawIdx)(vtx_inner_idx + (i0 << 1)); _IdxWritePtr[2] = (ImDrawIdx)(vtx_outer_idx + (i0 << 1));
@@ -2484,6 +2719,9 @@ ImFontAtlas::~ImFontAtlas()
 {
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
     Clear();
+#if defined(IMGUI_DPF_BACKEND) && defined(IMGUI_ENABLE_STB_TRUETYPE)
+    ImFontAtlasBuildSetDynamicGlyphs(this, false);
+#endif
 }
 
 void    ImFontAtlas::ClearInputData()
@@ -2857,6 +3095,207 @@ struct ImFontBuildDstData
     ImBitVector         GlyphsSet;          // This is used to resolve collision when multiple sources are merged into a same destination font.
 };
 
+#ifdef IMGUI_DPF_BACKEND
+// Dynamic glyphs data, kept outside of ImFontAtlas so that its layout does not depend on IMGUI_DPF_BACKEND
+struct ImFontAtlasDynamicSrcData
+{
+    stbtt_fontinfo      FontInfo;
+    int                 OversampleH, OversampleV;
+};
+
+struct ImFontAtlasDynamicTexUpdate
+{
+    int                 Version;
+    int                 Y0, Y1;             // Texture rows written by this update
+};
+
+struct ImFontAtlasDynamicData
+{
+    ImFontAtlas*        Atlas;
+    int                 MaxTexHeight;
+    bool                Packing;            // Set while PackContext is valid, after the atlas has been built
+    stbtt_pack_context  PackContext;
+    ImVector<ImFontAtlasDynamicSrcData> Sources;
+    ImGuiStorage        GlyphSources;       // Source index of pending glyphs, see ImFontAtlasDynamicGlyphKey()
+    int                 TexVersion;         // Never reset, so that backends can always compare against it
+    ImVector<ImFontAtlasDynamicTexUpdate> TexUpdates;
+};
+
+// Glyphs up to this codepoint are always rasterized by Build(), they are used by pretty much every UI
+static const unsigned int FONT_ATLAS_DYNAMIC_GLYPHS_EAGER_LAST = 0x7F;
+
+static ImVector<ImFontAtlasDynamicData*> GImFontAtlasDynamicData;
+
+static ImFontAtlasDynamicData* ImFontAtlasFindDynamicData(ImFontAtlas* atlas)
+{
+    for (ImFontAtlasDynamicData* data : GImFontAtlasDynamicData)
+        if (data->Atlas == atlas)
+            return data;
+    return NULL;
+}
+
+static inline ImGuiID ImFontAtlasDynamicGlyphKey(int font_index, unsigned int codepoint)
+{
+    return ((ImGuiID)font_index << 21) | codepoint;
+}
+
+static void ImFontAtlasDynamicClearPacking(ImFontAtlasDynamicData* data)
+{
+    if (data->Packing)
+        stbtt_PackEnd(&data->PackContext);
+    data->Packing = false;
+    data->Sources.clear();
+    data->GlyphSources.Clear();
+    data->TexUpdates.clear();
+}
+
+void ImFontAtlasBuildSetDynamicGlyphs(ImFontAtlas* atlas, bool enabled, int max_tex_height)
+{
+    IM_ASSERT(!atlas->Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
+    ImFontAtlasDynamicData* data = ImFontAtlasFindDynamicData(atlas);
+    if (enabled)
+    {
+        if (data == NULL)
+        {
+            data = IM_NEW(ImFontAtlasDynamicData)();
+            data->Atlas = atlas;
+            data->Packing = false;
+            data->TexVersion = 0;
+            GImFontAtlasDynamicData.push_back(data);
+        }
+        data->MaxTexHeight = max_tex_height;
+    }
+    else if (data != NULL)
+    {
+        ImFontAtlasDynamicClearPacking(data);
+        GImFontAtlasDynamicData.find_erase_unsorted(data);
+        IM_DELETE(data);
+        if (GImFontAtlasDynamicData.empty())
+            GImFontAtlasDynamicData.clear();
+    }
+}
+
+// Rasterize and pack a glyph that was left pending by ImFontAtlasBuildWithStbTruetype(), called by ImFont::FindGlyph()
+void ImFontAtlasBuildDynamicGlyph(ImFont* font, ImFontGlyph* glyph)
+{
+    ImFontAtlas* atlas = font->ContainerAtlas;
+    ImFontAtlasDynamicData* data = ImFontAtlasFindDynamicData(atlas);
+
+    // Not pending anymore whatever happens next, so failures are not retried on every use
+    glyph->U0 = glyph->U1 = 0.0f;
+
+    if (data == NULL || !data->Packing || atlas->TexPixelsAlpha8 == NULL)
+        return;
+
+    const int src_i = data->GlyphSources.GetInt(ImFontAtlasDynamicGlyphKey(atlas->Fonts.find_index(font), glyph->Codepoint), -1);
+    if (src_i < 0)
+        return;
+
+    ImFontConfig& src = atlas->Sources[src_i];
+    ImFontAtlasDynamicSrcData& src_data = data->Sources[src_i];
+    stbtt_pack_context& spc = data->PackContext;
+    int codepoint = (int)glyph->Codepoint;
+
+    // Gather rectangle size and pack it (same as ImFontAtlasBuildWithStbTruetype)
+    const float scale = (src.SizePixels > 0.0f) ? stbtt_ScaleForPixelHeight(&src_data.FontInfo, src.SizePixels * src.RasterizerDensity) : stbtt_ScaleForMappingEmToPixels(&src_data.FontInfo, -src.SizePixels * src.RasterizerDensity);
+    int x0, y0, x1, y1;
+    stbtt_GetGlyphBitmapBoxSubpixel(&src_data.FontInfo, stbtt_FindGlyphIndex(&src_data.FontInfo, codepoint), scale * src_data.OversampleH, scale * src_data.OversampleV, 0, 0, &x0, &y0, &x1, &y1);
+    stbrp_rect rect = {};
+    rect.w = (stbrp_coord)(x1 - x0 + atlas->TexGlyphPadding + src_data.OversampleH - 1);
+    rect.h = (stbrp_coord)(y1 - y0 + atlas->TexGlyphPadding + src_data.OversampleV - 1);
+    stbrp_pack_rects((stbrp_context*)spc.pack_info, &rect, 1);
+    if (!rect.was_packed)
+        return; // Atlas is full, glyph is left blank
+
+    // Render into the texture
+    stbtt_packedchar packed_char = {};
+    stbtt_pack_range pack_range = {};
+    pack_range.font_size = src.SizePixels * src.RasterizerDensity;
+    pack_range.array_of_unicode_codepoints = &codepoint;
+    pack_range.num_chars = 1;
+    pack_range.chardata_for_range = &packed_char;
+    pack_range.h_oversample = (unsigned char)src_data.OversampleH;
+    pack_range.v_oversample = (unsigned char)src_data.OversampleV;
+    spc.pixels = atlas->TexPixelsAlpha8;
+    stbtt_PackFontRangesRenderIntoRects(&spc, &src_data.FontInfo, &pack_range, 1, &rect);
+
+    if (src.RasterizerMultiply != 1.0f)
+    {
+        unsigned char multiply_table[256];
+        ImFontAtlasBuildMultiplyCalcLookupTable(multiply_table, src.RasterizerMultiply);
+        ImFontAtlasBuildMultiplyRectAlpha8(multiply_table, atlas->TexPixelsAlpha8, rect.x, rect.y, rect.w, rect.h, atlas->TexWidth * 1);
+    }
+
+    // Keep RGBA32 data in sync, as converted by GetTexDataAsRGBA32()
+    if (atlas->TexPixelsRGBA32 != NULL)
+    {
+        for (int y = rect.y; y < rect.y + rect.h; y++)
+        {
+            const unsigned char* src_pixel = atlas->TexPixelsAlpha8 + rect.x + y * atlas->TexWidth;
+            unsigned int* dst_pixel = atlas->TexPixelsRGBA32 + rect.x + y * atlas->TexWidth;
+            for (int n = rect.w; n > 0; n--)
+                *dst_pixel++ = IM_COL32(255, 255, 255, (unsigned int)(*src_pixel++));
+        }
+    }
+
+    // Setup glyph (same as ImFontAtlasBuildWithStbTruetype and ImFont::AddGlyph, advance was already processed when the glyph was added)
+    const float font_off_x = src.GlyphOffset.x;
+    const float font_off_y = src.GlyphOffset.y + IM_ROUND(font->Ascent);
+    const float inv_rasterization_scale = 1.0f / src.RasterizerDensity;
+    stbtt_aligned_quad q;
+    float unused_x = 0.0f, unused_y = 0.0f;
+    stbtt_GetPackedQuad(&packed_char, atlas->TexWidth, atlas->TexHeight, 0, &unused_x, &unused_y, &q, 0);
+    float char_off_x = 0.0f;
+    const float advance_x_original = packed_char.xadvance * inv_rasterization_scale;
+    const float advance_x = ImClamp(advance_x_original, src.GlyphMinAdvanceX, src.GlyphMaxAdvanceX);
+    if (advance_x != advance_x_original)
+        char_off_x = src.PixelSnapH ? ImTrunc((advance_x - advance_x_original) * 0.5f) : (advance_x - advance_x_original) * 0.5f;
+    glyph->X0 = q.x0 * inv_rasterization_scale + font_off_x + char_off_x;
+    glyph->Y0 = q.y0 * inv_rasterization_scale + font_off_y;
+    glyph->X1 = q.x1 * inv_rasterization_scale + font_off_x + char_off_x;
+    glyph->Y1 = q.y1 * inv_rasterization_scale + font_off_y;
+    glyph->U0 = q.s0;
+    glyph->V0 = q.t0;
+    glyph->U1 = q.s1;
+    glyph->V1 = q.t1;
+    glyph->Visible = (glyph->X0 != glyph->X1) && (glyph->Y0 != glyph->Y1);
+
+    // Let backends know which part of the texture needs to be uploaded again
+    ImFontAtlasDynamicTexUpdate update;
+    update.Version = ++data->TexVersion;
+    update.Y0 = rect.y;
+    update.Y1 = rect.y + rect.h;
+    data->TexUpdates.push_back(update);
+}
+
+int ImFontAtlasGetTexVersion(ImFontAtlas* atlas)
+{
+    ImFontAtlasDynamicData* data = ImFontAtlasFindDynamicData(atlas);
+    return data ? data->TexVersion : 0;
+}
+
+bool ImFontAtlasGetTexUpdateRows(ImFontAtlas* atlas, int since_version, int* out_y, int* out_height)
+{
+    ImFontAtlasDynamicData* data = ImFontAtlasFindDynamicData(atlas);
+    if (data == NULL || data->TexVersion <= since_version)
+        return false;
+
+    int y0 = INT_MAX, y1 = 0;
+    for (const ImFontAtlasDynamicTexUpdate& update : data->TexUpdates)
+        if (update.Version > since_version)
+        {
+            y0 = ImMin(y0, update.Y0);
+            y1 = ImMax(y1, update.Y1);
+        }
+    if (y0 >= y1)
+        return false;
+
+    *out_y = y0;
+    *out_height = y1 - y0;
+    return true;
+}
+#endif // IMGUI_DPF_BACKEND
+
 static void UnpackBitVectorToFlatIndexList(const ImBitVector* in, ImVector<int>* out)
 {
     IM_ASSERT(sizeof(in->Storage.Data[0]) == sizeof(int));
@@ -2875,6 +3314,12 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 
     ImFontAtlasBuildInit(atlas);
 
+#ifdef IMGUI_DPF_BACKEND
+    ImFontAtlasDynamicData* dynamic_data = ImFontAtlasFindDynamicData(atlas);
+    if (dynamic_data != NULL)
+        ImFontAtlasDynamicClearPacking(dynamic_data);
+#endif
+
     // Clear atlas
     atlas->TexID = (ImTextureID)NULL;
     atlas->TexWidth = atlas->TexHeight = 0;
@@ -3021,8 +3466,25 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
             src_tmp.Rects[glyph_i].w = (stbrp_coord)(x1 - x0 + pack_padding + oversample_h - 1);
             src_tmp.Rects[glyph_i].h = (stbrp_coord)(y1 - y0 + pack_padding + oversample_v - 1);
             total_surface += src_tmp.Rects[glyph_i].w * src_tmp.Rects[glyph_i].h;
+#ifdef IMGUI_DPF_BACKEND
+            // Dynamic glyphs are packed on first use, an empty rectangle is neither packed nor rendered
+            if (dynamic_data != NULL && (unsigned int)src_tmp.GlyphsList[glyph_i] > FONT_ATLAS_DYNAMIC_GLYPHS_EAGER_LAST)
+                src_tmp.Rects[glyph_i].w = src_tmp.Rects[glyph_i].h = 0;
+#endif
+        }
+    }
+#ifdef IMGUI_DPF_BACKEND
+    if (dynamic_data != NULL)
+    {
+        dynamic_data->Sources.resize(src_tmp_array.Size);
+        for (int src_i = 0; src_i < src_tmp_array.Size; src_i++)
+        {
+            ImFontAtlasDynamicSrcData& src_data = dynamic_data->Sources[src_i];
+            src_data.FontInfo = src_tmp_array[src_i].FontInfo;
+            ImFontAtlasBuildGetOversampleFactors(&atlas->Sources[src_i], &src_data.OversampleH, &src_data.OversampleV);
         }
     }
+#endif
     for (int i = 0; i < atlas->CustomRects.Size; i++)
         total_surface += (atlas->CustomRects[i].Width + pack_padding) * (atlas->CustomRects[i].Height + pack_padding);
 
@@ -3061,6 +3523,11 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     }
 
     // 7. Allocate texture
+#ifdef IMGUI_DPF_BACKEND
+    // Reserve space for dynamic glyphs, from the surface estimate of all glyphs plus some packing slack
+    if (dynamic_data != NULL)
+        atlas->TexHeight = ImMax(atlas->TexHeight, ImMin(total_surface / atlas->TexWidth * 5 / 4, dynamic_data->MaxTexHeight));
+#endif
     atlas->TexHeight = (atlas->Flags & ImFontAtlasFlags_NoPowerOfTwoHeight) ? (atlas->TexHeight + 1) : ImUpperPowerOfTwo(atlas->TexHeight);
     atlas->TexUvScale = ImVec2(1.0f / atlas->TexWidth, 1.0f / atlas->TexHeight);
     atlas->TexPixelsAlpha8 = (unsigned char*)IM_ALLOC(atlas->TexWidth * atlas->TexHeight);
@@ -3092,6 +3559,16 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
     }
 
     // End packing
+#ifdef IMGUI_DPF_BACKEND
+    if (dynamic_data != NULL)
+    {
+        // Keep the packing context around for dynamic glyphs, limited to the allocated texture
+        ((stbrp_context*)spc.pack_info)->height = atlas->TexHeight;
+        dynamic_data->PackContext = spc;
+        dynamic_data->Packing = true;
+    }
+    else
+#endif
     stbtt_PackEnd(&spc);
     buf_rects.clear();
 
@@ -3116,11 +3593,27 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
         const float font_off_y = src.GlyphOffset.y + IM_ROUND(dst_font->Ascent);
 
         const float inv_rasterization_scale = 1.0f / src.RasterizerDensity;
+#ifdef IMGUI_DPF_BACKEND
+        const float pack_scale = (src.SizePixels > 0.0f) ? stbtt_ScaleForPixelHeight(&src_tmp.FontInfo, src.SizePixels * src.RasterizerDensity) : stbtt_ScaleForMappingEmToPixels(&src_tmp.FontInfo, -src.SizePixels * src.RasterizerDensity);
+#endif
 
         for (int glyph_i = 0; glyph_i < src_tmp.GlyphsCount; glyph_i++)
         {
             // Register glyph
             const int codepoint = src_tmp.GlyphsList[glyph_i];
+#ifdef IMGUI_DPF_BACKEND
+            // Dynamic glyphs only get their metrics for now, negative UVs mark them as pending until ImFont::FindGlyph() is called on them
+            if (dynamic_data != NULL && (unsigned int)codepoint > FONT_ATLAS_DYNAMIC_GLYPHS_EAGER_LAST)
+            {
+                int advance, lsb;
+                stbtt_GetCodepointHMetrics(&src_tmp.FontInfo, codepoint, &advance, &lsb);
+                dst_font->AddGlyph(&src, (ImWchar)codepoint, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, pack_scale * advance * inv_rasterization_scale);
+                ImFontGlyph& glyph = dst_font->Glyphs.back();
+                glyph.U0 = glyph.U1 = -1.0f;
+                dynamic_data->GlyphSources.SetInt(ImFontAtlasDynamicGlyphKey(src_tmp.DstIndex, (unsigned int)codepoint), src_i);
+                continue;
+            }
+#endif
             const stbtt_packedchar& pc = src_tmp.PackedChars[glyph_i];
             stbtt_aligned_quad q;
             float unused_x = 0.0f, unused_y = 0.0f;
@@ -3712,6 +4205,9 @@ void    ImFont::ClearOutputData()
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
     memset(Used8kPagesMap, 0, sizeof(Used8kPagesMap));
+#ifdef IMGUI_DPF_TEXT_SIZE_CACHE
+    ImFontTextSizeCacheClear();
+#endif
 }
 
 static ImWchar FindFirstExistingGlyph(ImFont* font, const ImWchar* candidate_chars, int candidate_chars_count)
@@ -3735,6 +4231,9 @@ void ImFont::BuildLookupTable()
     IndexLookup.clear();
     DirtyLookupTables = false;
     memset(Used8kPagesMap, 0, sizeof(Used8kPagesMap));
+#ifdef IMGUI_DPF_TEXT_SIZE_CACHE
+    ImFontTextSizeCacheClear();
+#endif
     GrowIndex(max_codepoint + 1);
     for (int i = 0; i < Glyphs.Size; i++)
     {
@@ -3780,6 +4279,11 @@ void ImFont::BuildLookupTable()
             FallbackChar = (ImWchar)FallbackGlyph->Codepoint;
         }
     }
+#if defined(IMGUI_DPF_BACKEND) && defined(IMGUI_ENABLE_STB_TRUETYPE)
+    // DPF: FindGlyph() returns the fallback glyph as-is for every missing character, so it cannot be left pending
+    if (FallbackGlyph->U0 < 0.0f)
+        ImFontAtlasBuildDynamicGlyph(this, FallbackGlyph);
+#endif
     FallbackAdvanceX = FallbackGlyph->AdvanceX;
     for (int i = 0; i < max_codepoint + 1; i++)
         if (IndexAdvanceX[i] < 0.0f)
@@ -3890,6 +4394,9 @@ void ImFont::AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst)
         return;
 
     GrowIndex(dst + 1);
+#ifdef IMGUI_DPF_TEXT_SIZE_CACHE
+    ImFontTextSizeCacheClear();
+#endif
     IndexLookup[dst] = (src < index_size) ? IndexLookup.Data[src] : (ImU16)-1;
     IndexAdvanceX[dst] = (src < index_size) ? IndexAdvanceX.Data[src] : 1.0f;
 }
@@ -3902,6 +4409,10 @@ ImFontGlyph* ImFont::FindGlyph(ImWchar c)
     const ImU16 i = IndexLookup.Data[c];
     if (i == (ImU16)-1)
         return FallbackGlyph;
+#if defined(IMGUI_DPF_BACKEND) && defined(IMGUI_ENABLE_STB_TRUETYPE)
+    if (Glyphs.Data[i].U0 < 0.0f)
+        ImFontAtlasBuildDynamicGlyph(this, &Glyphs.Data[i]);
+#endif
     return &Glyphs.Data[i];
 }
 
@@ -4028,11 +4539,100 @@ const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const c
     return s;
 }
 
+#ifdef IMGUI_DPF_TEXT_SIZE_CACHE
+// DPF: Cache of CalcTextSizeA() results, as most text measured in a frame (e.g. labels) was already measured in the previous frames.
+// Entries are keyed by font, sizes, text length and a hash of the text, in an 8-way set associative table with least recently used replacement.
+// Cleared whenever a font lookup table changes (atlas build, font destruction). Like shared font atlases, this is not thread-safe.
+struct ImFontTextSizeCacheEntry
+{
+    const ImFont*   Font;
+    ImU32           TextHash;
+    int             TextLength;
+    float           Size, MaxWidth, WrapWidth;
+    ImVec2          TextSize;
+    ImU32           LastUse;            // 0 for unused entries
+};
+
+static const int FONT_TEXT_SIZE_CACHE_SETS = 256;
+static const int FONT_TEXT_SIZE_CACHE_WAYS = 8;
+static const int FONT_TEXT_SIZE_CACHE_MIN_LENGTH = 8; // Shorter text is about as cheap to measure as to look up
+
+static ImFontTextSizeCacheEntry GImFontTextSizeCache[FONT_TEXT_SIZE_CACHE_SETS][FONT_TEXT_SIZE_CACHE_WAYS];
+static ImU32 GImFontTextSizeCacheUseCounter = 0;
+static ImFontTextSizeCacheStats GImFontTextSizeCacheStats;
+
+void ImFontTextSizeCacheClear()
+{
+    memset(GImFontTextSizeCache, 0, sizeof(GImFontTextSizeCache));
+    GImFontTextSizeCacheStats.Clears++;
+}
+
+void ImFontTextSizeCacheGetStats(ImFontTextSizeCacheStats* out_stats)
+{
+    *out_stats = GImFontTextSizeCacheStats;
+}
+
+void ImFontTextSizeCacheResetStats()
+{
+    GImFontTextSizeCacheStats = ImFontTextSizeCacheStats();
+}
+
+static ImVec2 ImFontTextSizeCacheCalc(ImFont* font, float size, float max_width, float wrap_width, const char* text_begin, const char* text_end)
+{
+    const int text_length = (int)(text_end - text_begin);
+    const ImU32 text_hash = ImHashData(text_begin, (size_t)text_length);
+    ImU32 size_bits;
+    memcpy(&size_bits, &size, sizeof(size_bits));
+    ImU32 set_hash = (text_hash ^ size_bits ^ (ImU32)((size_t)font >> 4)) * 0x9E3779B1u;
+    set_hash ^= set_hash >> 16;
+    ImFontTextSizeCacheEntry* set = GImFontTextSizeCache[set_hash & (FONT_TEXT_SIZE_CACHE_SETS - 1)];
+
+    if (++GImFontTextSizeCacheUseCounter == 0)
+        GImFontTextSizeCacheUseCounter = 1;
+
+    ImFontTextSizeCacheEntry* oldest = &set[0];
+    for (int n = 0; n < FONT_TEXT_SIZE_CACHE_WAYS; n++)
+    {
+        ImFontTextSizeCacheEntry* entry = &set[n];
+        if (entry->LastUse != 0 && entry->TextHash == text_hash && entry->TextLength == text_length && entry->Font == font &&
+            entry->Size == size && entry->MaxWidth == max_width && entry->WrapWidth == wrap_width)
+        {
+            entry->LastUse = GImFontTextSizeCacheUseCounter;
+            GImFontTextSizeCacheStats.Hits++;
+            return entry->TextSize;
+        }
+        if (entry->LastUse < oldest->LastUse)
+            oldest = entry;
+    }
+
+    // Not found, measure and replace the least recently used entry (or an unused one)
+    const char* remaining; // Non-NULL to bypass the cache
+    const ImVec2 text_size = font->CalcTextSizeA(size, max_width, wrap_width, text_begin, text_end, &remaining);
+    if (oldest->LastUse != 0)
+        GImFontTextSizeCacheStats.Evictions++;
+    GImFontTextSizeCacheStats.Misses++;
+    oldest->Font = font;
+    oldest->TextHash = text_hash;
+    oldest->TextLength = text_length;
+    oldest->Size = size;
+    oldest->MaxWidth = max_width;
+    oldest->WrapWidth = wrap_width;
+    oldest->TextSize = text_size;
+    oldest->LastUse = GImFontTextSizeCacheUseCounter;
+    return text_size;
+}
+#endif // IMGUI_DPF_TEXT_SIZE_CACHE
+
 ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, const char* text_begin, const char* text_end, const char** remaining)
 {
     if (!text_end)
         text_end = text_begin + ImStrlen(text_begin); // FIXME-OPT: Need to avoid this.
 
+#ifdef IMGUI_DPF_TEXT_SIZE_CACHE
+    if (remaining == NULL && text_end - text_begin >= FONT_TEXT_SIZE_CACHE_MIN_LENGTH)
+        return ImFontTextSizeCacheCalc(this, size, max_width, wrap_width, text_begin, text_end);
+#endif
+
     const float line_height = size;
     const float scale = size / FontSize;
 
@@ -4121,6 +4721,80 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, Im
     draw_list->PrimRectUV(ImVec2(x + glyph->X0 * scale, y + glyph->Y0 * scale), ImVec2(x + glyph->X1 * scale, y + glyph->Y1 * scale), ImVec2(glyph->U0, glyph->V0), ImVec2(glyph->U1, glyph->V1), col);
 }
 
+#ifdef IMGUI_DPF_SIMD_TEXT
+// DPF: Same as the main loop of ImFont::RenderText() below when there is no word wrapping nor fine clipping, which is most text.
+// ImFontGlyph corners and texture coordinates are loaded as vectors and every quad is written with 4 vector stores.
+// Quads of glyphs that are not visible or horizontally clipped are written anyway and simply not kept, avoiding unpredictable branches.
+// ASCII glyphs are looked up directly, as they are rasterized when building the atlas (see FONT_ATLAS_DYNAMIC_GLYPHS_EAGER_LAST),
+// unless remapped to a dynamic glyph with AddRemapChar(), in which case they go through FindGlyph() to get rasterized.
+IM_STATIC_ASSERT(offsetof(ImFontGlyph, Y1) == offsetof(ImFontGlyph, X0) + 12 && offsetof(ImFontGlyph, V1) == offsetof(ImFontGlyph, U0) + 12);
+static void ImFont_SimdRenderText(ImFont* font, float scale, float x, float y, ImU32 col, const ImVec4& clip_rect, const char* s, const char* text_end, ImDrawVert*& vtx_write_ref, ImDrawIdx*& idx_write_ref, unsigned int& vtx_index_ref)
+{
+    const float line_height = font->FontSize * scale;
+    const float origin_x = x;
+    const ImU32 col_untinted = col | ~IM_COL32_A_MASK;
+    const ImDrawSimd4 scale4 = ImDrawSimd_Set(scale, scale);
+    const int ascii_count = ImMin(font->IndexLookup.Size, 0x80);
+    const ImU16* index_lookup = font->IndexLookup.Data;
+    const ImFontGlyph* glyphs = font->Glyphs.Data;
+    ImDrawVert* vtx_write = vtx_write_ref;
+    ImDrawIdx* idx_write = idx_write_ref;
+    unsigned int vtx_index = vtx_index_ref;
+
+    while (s < text_end)
+    {
+        // Decode and advance source
+        unsigned int c = (unsigned int)*s;
+        const ImFontGlyph* glyph;
+        if (c < 0x80)
+        {
+            s += 1;
+            if (c < 32)
+            {
+                if (c == '\n')
+                {
+                    x = origin_x;
+                    y += line_height;
+                    if (y > clip_rect.w)
+                        break; // break out of main loop
+                    continue;
+                }
+                if (c == '\r')
+                    continue;
+            }
+            const ImU16 i = (int)c < ascii_count ? index_lookup[c] : (ImU16)-1;
+            glyph = i != (ImU16)-1 ? &glyphs[i] : font->FallbackGlyph;
+            if (glyph != NULL && glyph->U0 < 0.0f)
+                glyph = font->FindGlyph((ImWchar)c);
+        }
+        else
+        {
+            s += ImTextCharFromUtf8(&c, s, text_end);
+            glyph = font->FindGlyph((ImWchar)c);
+        }
+        if (glyph == NULL)
+            continue;
+
+        // We don't do a second finer clipping test on the Y axis as we've already skipped anything before clip_rect.y and exit once we pass clip_rect.w
+        const ImDrawSimd4 pos = ImDrawSimd_Add(ImDrawSimd_Set(x, y), ImDrawSimd_Mul(ImDrawSimd_Load4(&glyph->X0), scale4)); // x1, y1, x2, y2
+        const float x1 = x + glyph->X0 * scale;
+        const float x2 = x + glyph->X1 * scale;
+        ImDrawSimd_WriteQuad(vtx_write, pos, ImDrawSimd_Load4(&glyph->U0), glyph->Colored ? col_untinted : col);
+        idx_write[0] = (ImDrawIdx)(vtx_index); idx_write[1] = (ImDrawIdx)(vtx_index + 1); idx_write[2] = (ImDrawIdx)(vtx_index + 2);
+        idx_write[3] = (ImDrawIdx)(vtx_index); idx_write[4] = (ImDrawIdx)(vtx_index + 2); idx_write[5] = (ImDrawIdx)(vtx_index + 3);
+        const unsigned int keep = (glyph->Visible && x1 <= clip_rect.z && x2 >= clip_rect.x) ? 1 : 0;
+        vtx_write += keep * 4;
+        vtx_index += keep * 4;
+        idx_write += keep * 6;
+        x += glyph->AdvanceX * scale;
+    }
+
+    vtx_write_ref = vtx_write;
+    idx_write_ref = idx_write;
+    vtx_index_ref = vtx_index;
+}
+#endif
+
 // Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
 void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width, bool cpu_fine_clip)
 {
@@ -4188,6 +4862,14 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
     const ImU32 col_untinted = col | ~IM_COL32_A_MASK;
     const char* word_wrap_eol = NULL;
 
+#ifdef IMGUI_DPF_SIMD_TEXT
+    if (!word_wrap_enabled && !cpu_fine_clip)
+    {
+        ImFont_SimdRenderText(this, scale, x, y, col, clip_rect, s, text_end, vtx_write, idx_write, vtx_index);
+        s = text_end;
+    }
+#endif
+
     while (s < text_end)
     {
         if (word_wrap_enabled)
@@ -46,6 +46,9 @@
 #include "imgui.h"
 #ifndef IMGUI_DISABLE
 #include "imgui_impl_opengl2.h"
+#ifdef IMGUI_DPF_BACKEND
+#include "imgui_internal.h"     // ImFontAtlasGetTexUpdateRows()
+#endif
 #include <stdint.h>     // intptr_t
 
 // Clang/GCC warnings with -Weverything
@@ -55,6 +58,15 @@
 #pragma clang diagnostic ignored "-Wnonportable-system-include-path"
 #endif
 
+#ifdef IMGUI_DPF_BACKEND
+#include <stdio.h>      // sscanf, snprintf
+#endif
+#if defined(IMGUI_DPF_BACKEND) && defined(_WIN32)
+#include <windows.h>    // wglGetProcAddress
+#elif defined(IMGUI_DPF_BACKEND) && defined(__APPLE__)
+#include <dlfcn.h>      // dlsym
+#endif
+
 // Include OpenGL header (without an OpenGL loader) requires a bit of fiddling
 #if defined(_WIN32) && !defined(APIENTRY)
 #define APIENTRY __stdcall                  // It is customary to use APIENTRY for OpenGL function pointer declarations on all platforms.  Additionally, the Windows OpenGL header needs APIENTRY.
@@ -78,10 +90,127 @@
 #define GL_CALL(_CALL)      _CALL   // Call without error check
 #endif
 
+#ifdef IMGUI_DPF_BACKEND
+// DPF: functions and definitions beyond OpenGL 1.1, which legacy GL headers and libraries do not always provide.
+// These are loaded at runtime and only used if the current context supports them.
+#ifndef APIENTRYP
+#define APIENTRYP APIENTRY *
+#endif
+#ifndef GL_FRAMEBUFFER
+#define GL_FRAMEBUFFER                  0x8D40
+#define GL_FRAMEBUFFER_BINDING          0x8CA6
+#define GL_FRAMEBUFFER_COMPLETE         0x8CD5
+#define GL_COLOR_ATTACHMENT0            0x8CE0
+#endif
+#ifndef GL_CLAMP_TO_EDGE
+#define GL_CLAMP_TO_EDGE                0x812F
+#endif
+#ifndef GL_ARRAY_BUFFER
+#define GL_ARRAY_BUFFER                 0x8892
+#define GL_ELEMENT_ARRAY_BUFFER         0x8893
+#define GL_ARRAY_BUFFER_BINDING         0x8894
+#define GL_ELEMENT_ARRAY_BUFFER_BINDING 0x8895
+#define GL_STREAM_DRAW                  0x88E0
+#endif
+#ifndef GL_PIXEL_UNPACK_BUFFER
+#define GL_PIXEL_UNPACK_BUFFER          0x88EC
+#endif
+#ifndef GL_QUERY_RESULT
+#define GL_QUERY_RESULT                 0x8866
+#define GL_QUERY_RESULT_AVAILABLE       0x8867
+#endif
+#ifndef GL_TIME_ELAPSED
+#define GL_TIME_ELAPSED                 0x88BF
+#endif
+#define IMGUI_IMPL_OPENGL_TIMER_QUERIES 3   // Number of timer queries that can be in flight before skipping measurements
+typedef void   (APIENTRYP ImGui_ImplOpenGL2_PFN_BlendFuncSeparate)(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha);
+typedef void   (APIENTRYP ImGui_ImplOpenGL2_PFN_GenFramebuffers)(GLsizei n, GLuint* framebuffers);
+typedef void   (APIENTRYP ImGui_ImplOpenGL2_PFN_DeleteFramebuffers)(GLsizei n, const GLuint* framebuffers);
+typedef void   (APIENTRYP ImGui_ImplOpenGL2_PFN_BindFramebuffer)(GLenum target, GLuint framebuffer);
+typedef void   (APIENTRYP ImGui_ImplOpenGL2_PFN_FramebufferTexture2D)(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level);
+typedef GLenum (APIENTRYP ImGui_ImplOpenGL2_PFN_CheckFramebufferStatus)(GLenum target);
+typedef void   (APIENTRYP ImGui_ImplOpenGL2_PFN_GenBuffers)(GLsizei n, GLuint* buffers);
+typedef void   (APIENTRYP ImGui_ImplOpenGL2_PFN_DeleteBuffers)(GLsizei n, const GLuint* buffers);
+typedef void   (APIENTRYP ImGui_ImplOpenGL2_PFN_BindBuffer)(GLenum target, GLuint buffer);
+typedef void   (APIENTRYP ImGui_ImplOpenGL2_PFN_BufferData)(GLenum target, ptrdiff_t size, const void* data, GLenum usage);
+typedef void   (APIENTRYP ImGui_ImplOpenGL2_PFN_BufferSubData)(GLenum target, ptrdiff_t offset, ptrdiff_t size, const void* data);
+typedef void   (APIENTRYP ImGui_ImplOpenGL2_PFN_GenQueries)(GLsizei n, GLuint* ids);
+typedef void   (APIENTRYP ImGui_ImplOpenGL2_PFN_DeleteQueries)(GLsizei n, const GLuint* ids);
+typedef void   (APIENTRYP ImGui_ImplOpenGL2_PFN_BeginQuery)(GLenum target, GLuint id);
+typedef void   (APIENTRYP ImGui_ImplOpenGL2_PFN_EndQuery)(GLenum target);
+typedef void   (APIENTRYP ImGui_ImplOpenGL2_PFN_GetQueryObjectiv)(GLuint id, GLenum pname, GLint* params);
+typedef void   (APIENTRYP ImGui_ImplOpenGL2_PFN_GetQueryObjectui64v)(GLuint id, GLenum pname, ImU64* params);
+#if !defined(_WIN32) && !defined(__APPLE__)
+extern "C" void (*glXGetProcAddressARB(const GLubyte* procName))(void);
+#endif
+#endif
+
+#ifdef IMGUI_DPF_BACKEND
+// DPF: texture created with ImGui_ImplOpenGL2_CreateUserTexture(), with a copy of its pixels and the rows changed since the last upload
+struct ImGui_ImplOpenGL2_UserTexture
+{
+    GLuint          Texture;
+    int             Width, Height;
+    unsigned char*  Pixels;
+    int             DirtyY0, DirtyY1;
+};
+#endif
+
+#if defined(IMGUI_DPF_COMPACT_DRAWVERT) && !defined(IMGUI_DPF_BACKEND)
+#error "IMGUI_DPF_COMPACT_DRAWVERT requires IMGUI_DPF_BACKEND"
+#endif
+
 // OpenGL data
 struct ImGui_ImplOpenGL2_Data
 {
     GLuint       FontTexture;
+#ifdef IMGUI_DPF_BACKEND
+    int          GlVersion;                 // Extracted at runtime from GL_VERSION string (e.g. 210 for GL 2.1)
+    bool         HasFramebuffers;
+    GLuint       CacheFramebuffer;          // Offscreen framebuffer used to keep the last rendered frame around
+    GLuint       CacheTexture;
+    int          CacheWidth, CacheHeight;
+    bool         CacheValid;
+    bool         RenderingToCache;
+    bool         UseCacheDamageBox;         // Only render within CacheDamageBox, for partial updates of the cached frame
+    GLint        CacheDamageBox[4];
+    bool         CompositingCache;
+    ImDrawList*  CacheDrawList;             // Single textured quad used to composite the cached frame
+    int          FontTextureVersion;        // Font atlas version uploaded to FontTexture, for dynamic glyphs
+    int          TextureUploads;            // Number of texture uploads done so far, for profiling
+    bool         HasVertexBuffers;
+    GLuint       VboHandle, ElementsHandle;  // Vertex buffer objects holding all draw lists of a frame, when available
+    ImVector<char> UploadBuffer;            // Staging memory for merging all draw lists into a single upload
+    bool         StateCacheValid;           // Scissor box and texture last set for a draw command, to skip redundant state changes
+    GLint        ScissorBox[4];
+    GLuint       BoundTexture;
+    ImVector<ImGui_ImplOpenGL2_UserTexture> UserTextures;
+    bool         HasPixelBuffers;
+    GLuint       PixelBuffers[2];           // Pixel unpack buffers for user texture uploads, used alternately so that an upload does not wait for the previous one
+    int          PixelBufferIndex;
+    bool         HasTimerQueries;
+    GLuint       TimerQueries[IMGUI_IMPL_OPENGL_TIMER_QUERIES];    // Ring of timer queries, TimerQueryCount of them waiting for results from TimerQueryFirst on
+    int          TimerQueryTags[IMGUI_IMPL_OPENGL_TIMER_QUERIES];
+    int          TimerQueryFirst, TimerQueryCount;
+    bool         TimerQueryActive;
+    ImGui_ImplOpenGL2_PFN_BlendFuncSeparate       BlendFuncSeparate;
+    ImGui_ImplOpenGL2_PFN_GenFramebuffers         GenFramebuffers;
+    ImGui_ImplOpenGL2_PFN_DeleteFramebuffers      DeleteFramebuffers;
+    ImGui_ImplOpenGL2_PFN_BindFramebuffer         BindFramebuffer;
+    ImGui_ImplOpenGL2_PFN_FramebufferTexture2D    FramebufferTexture2D;
+    ImGui_ImplOpenGL2_PFN_CheckFramebufferStatus  CheckFramebufferStatus;
+    ImGui_ImplOpenGL2_PFN_GenBuffers              GenBuffers;
+    ImGui_ImplOpenGL2_PFN_DeleteBuffers           DeleteBuffers;
+    ImGui_ImplOpenGL2_PFN_BindBuffer              BindBuffer;
+    ImGui_ImplOpenGL2_PFN_BufferData              BufferData;
+    ImGui_ImplOpenGL2_PFN_BufferSubData           BufferSubData;
+    ImGui_ImplOpenGL2_PFN_GenQueries              GenQueries;
+    ImGui_ImplOpenGL2_PFN_DeleteQueries           DeleteQueries;
+    ImGui_ImplOpenGL2_PFN_BeginQuery              BeginQuery;
+    ImGui_ImplOpenGL2_PFN_EndQuery                EndQuery;
+    ImGui_ImplOpenGL2_PFN_GetQueryObjectiv        GetQueryObjectiv;
+    ImGui_ImplOpenGL2_PFN_GetQueryObjectui64v     GetQueryObjectui64v;
+#endif
 
     ImGui_ImplOpenGL2_Data() { memset((void*)this, 0, sizeof(*this)); }
 };
@@ -93,6 +222,125 @@ static ImGui_ImplOpenGL2_Data* ImGui_ImplOpenGL2_GetBackendData()
     return ImGui::GetCurrentContext() ? (ImGui_ImplOpenGL2_Data*)ImGui::GetIO().BackendRendererUserData : nullptr;
 }
 
+#ifdef IMGUI_DPF_BACKEND
+static void* ImGui_ImplOpenGL2_GetProcAddress(const char* name)
+{
+#if defined(_WIN32)
+    return (void*)wglGetProcAddress(name);
+#elif defined(__APPLE__)
+    return dlsym(RTLD_DEFAULT, name);
+#else
+    return (void*)glXGetProcAddressARB((const GLubyte*)name);
+#endif
+}
+
+static bool ImGui_ImplOpenGL2_HasExtension(const char* name)
+{
+    const char* extensions = (const char*)glGetString(GL_EXTENSIONS);
+    const size_t name_len = strlen(name);
+    for (const char* ext = extensions; ext != nullptr && (ext = strstr(ext, name)) != nullptr; ext += name_len)
+        if ((ext == extensions || ext[-1] == ' ') && (ext[name_len] == ' ' || ext[name_len] == '\0'))
+            return true;
+    return false;
+}
+
+// Load the extra functions we use, checking version and extensions first, as some loaders return non-null for anything
+static void ImGui_ImplOpenGL2_InitFunctions(ImGui_ImplOpenGL2_Data* bd)
+{
+    int major = 0, minor = 0;
+    if (const char* gl_version_str = (const char*)glGetString(GL_VERSION))
+        sscanf(gl_version_str, "%d.%d", &major, &minor);
+    bd->GlVersion = major * 100 + minor * 10;
+
+    if (bd->GlVersion >= 140)
+        bd->BlendFuncSeparate = (ImGui_ImplOpenGL2_PFN_BlendFuncSeparate)ImGui_ImplOpenGL2_GetProcAddress("glBlendFuncSeparate");
+
+    const char* fbo_suffix = nullptr;
+    if (bd->GlVersion >= 300 || ImGui_ImplOpenGL2_HasExtension("GL_ARB_framebuffer_object"))
+        fbo_suffix = "";
+    else if (ImGui_ImplOpenGL2_HasExtension("GL_EXT_framebuffer_object"))
+        fbo_suffix = "EXT";
+
+    if (fbo_suffix != nullptr)
+    {
+        char name[64];
+        snprintf(name, sizeof(name), "glGenFramebuffers%s", fbo_suffix);
+        bd->GenFramebuffers = (ImGui_ImplOpenGL2_PFN_GenFramebuffers)ImGui_ImplOpenGL2_GetProcAddress(name);
+        snprintf(name, sizeof(name), "glDeleteFramebuffers%s", fbo_suffix);
+        bd->DeleteFramebuffers = (ImGui_ImplOpenGL2_PFN_DeleteFramebuffers)ImGui_ImplOpenGL2_GetProcAddress(name);
+        snprintf(name, sizeof(name), "glBindFramebuffer%s", fbo_suffix);
+        bd->BindFramebuffer = (ImGui_ImplOpenGL2_PFN_BindFramebuffer)ImGui_ImplOpenGL2_GetProcAddress(name);
+        snprintf(name, sizeof(name), "glFramebufferTexture2D%s", fbo_suffix);
+        bd->FramebufferTexture2D = (ImGui_ImplOpenGL2_PFN_FramebufferTexture2D)ImGui_ImplOpenGL2_GetProcAddress(name);
+        snprintf(name, sizeof(name), "glCheckFramebufferStatus%s", fbo_suffix);
+        bd->CheckFramebufferStatus = (ImGui_ImplOpenGL2_PFN_CheckFramebufferStatus)ImGui_ImplOpenGL2_GetProcAddress(name);
+    }
+
+    bd->HasFramebuffers = bd->BlendFuncSeparate != nullptr
+                       && bd->GenFramebuffers != nullptr
+                       && bd->DeleteFramebuffers != nullptr
+                       && bd->BindFramebuffer != nullptr
+                       && bd->FramebufferTexture2D != nullptr
+                       && bd->CheckFramebufferStatus != nullptr;
+
+    const char* vbo_suffix = nullptr;
+    if (bd->GlVersion >= 150)
+        vbo_suffix = "";
+    else if (ImGui_ImplOpenGL2_HasExtension("GL_ARB_vertex_buffer_object"))
+        vbo_suffix = "ARB";
+
+    if (vbo_suffix != nullptr)
+    {
+        char name[64];
+        snprintf(name, sizeof(name), "glGenBuffers%s", vbo_suffix);
+        bd->GenBuffers = (ImGui_ImplOpenGL2_PFN_GenBuffers)ImGui_ImplOpenGL2_GetProcAddress(name);
+        snprintf(name, sizeof(name), "glDeleteBuffers%s", vbo_suffix);
+        bd->DeleteBuffers = (ImGui_ImplOpenGL2_PFN_DeleteBuffers)ImGui_ImplOpenGL2_GetProcAddress(name);
+        snprintf(name, sizeof(name), "glBindBuffer%s", vbo_suffix);
+        bd->BindBuffer = (ImGui_ImplOpenGL2_PFN_BindBuffer)ImGui_ImplOpenGL2_GetProcAddress(name);
+        snprintf(name, sizeof(name), "glBufferData%s", vbo_suffix);
+        bd->BufferData = (ImGui_ImplOpenGL2_PFN_BufferData)ImGui_ImplOpenGL2_GetProcAddress(name);
+        snprintf(name, sizeof(name), "glBufferSubData%s", vbo_suffix);
+        bd->BufferSubData = (ImGui_ImplOpenGL2_PFN_BufferSubData)ImGui_ImplOpenGL2_GetProcAddress(name);
+    }
+
+    bd->HasVertexBuffers = bd->GenBuffers != nullptr
+                        && bd->DeleteBuffers != nullptr
+                        && bd->BindBuffer != nullptr
+                        && bd->BufferData != nullptr;
+
+    bd->HasPixelBuffers = bd->HasVertexBuffers
+                       && bd->BufferSubData != nullptr
+                       && (bd->GlVersion >= 210 || ImGui_ImplOpenGL2_HasExtension("GL_ARB_pixel_buffer_object"));
+
+    // Query objects are core since GL 1.5, GL_ARB_timer_query (core in 3.3) and GL_EXT_timer_query only add a 64-bit result getter
+    const char* timer_suffix = nullptr;
+    if (bd->GlVersion >= 330 || ImGui_ImplOpenGL2_HasExtension("GL_ARB_timer_query"))
+        timer_suffix = "";
+    else if (ImGui_ImplOpenGL2_HasExtension("GL_EXT_timer_query"))
+        timer_suffix = "EXT";
+
+    if (timer_suffix != nullptr && bd->GlVersion >= 150)
+    {
+        char name[64];
+        bd->GenQueries = (ImGui_ImplOpenGL2_PFN_GenQueries)ImGui_ImplOpenGL2_GetProcAddress("glGenQueries");
+        bd->DeleteQueries = (ImGui_ImplOpenGL2_PFN_DeleteQueries)ImGui_ImplOpenGL2_GetProcAddress("glDeleteQueries");
+        bd->BeginQuery = (ImGui_ImplOpenGL2_PFN_BeginQuery)ImGui_ImplOpenGL2_GetProcAddress("glBeginQuery");
+        bd->EndQuery = (ImGui_ImplOpenGL2_PFN_EndQuery)ImGui_ImplOpenGL2_GetProcAddress("glEndQuery");
+        bd->GetQueryObjectiv = (ImGui_ImplOpenGL2_PFN_GetQueryObjectiv)ImGui_ImplOpenGL2_GetProcAddress("glGetQueryObjectiv");
+        snprintf(name, sizeof(name), "glGetQueryObjectui64v%s", timer_suffix);
+        bd->GetQueryObjectui64v = (ImGui_ImplOpenGL2_PFN_GetQueryObjectui64v)ImGui_ImplOpenGL2_GetProcAddress(name);
+    }
+
+    bd->HasTimerQueries = bd->GenQueries != nullptr
+                       && bd->DeleteQueries != nullptr
+                       && bd->BeginQuery != nullptr
+                       && bd->EndQuery != nullptr
+                       && bd->GetQueryObjectiv != nullptr
+                       && bd->GetQueryObjectui64v != nullptr;
+}
+#endif
+
 // Functions
 bool    ImGui_ImplOpenGL2_Init()
 {
@@ -105,6 +353,10 @@ bool    ImGui_ImplOpenGL2_Init()
     io.BackendRendererUserData = (void*)bd;
     io.BackendRendererName = "imgui_impl_opengl2";
 
+#ifdef IMGUI_DPF_BACKEND
+    ImGui_ImplOpenGL2_InitFunctions(bd);
+#endif
+
     return true;
 }
 
@@ -115,6 +367,14 @@ void    ImGui_ImplOpenGL2_Shutdown()
     ImGuiIO& io = ImGui::GetIO();
 
     ImGui_ImplOpenGL2_DestroyDeviceObjects();
+#ifdef IMGUI_DPF_BACKEND
+    while (!bd->UserTextures.empty())
+        ImGui_ImplOpenGL2_DestroyUserTexture((ImTextureID)(intptr_t)bd->UserTextures.back().Texture);
+    for (GLuint& pixel_buffer : bd->PixelBuffers)
+        if (pixel_buffer != 0) { bd->DeleteBuffers(1, &pixel_buffer); pixel_buffer = 0; }
+    if (bd->TimerQueries[0] != 0)
+        bd->DeleteQueries(IMGUI_IMPL_OPENGL_TIMER_QUERIES, bd->TimerQueries);
+#endif
     io.BackendRendererName = nullptr;
     io.BackendRendererUserData = nullptr;
     IM_DELETE(bd);
@@ -129,28 +389,80 @@ void    ImGui_ImplOpenGL2_NewFrame()
         ImGui_ImplOpenGL2_CreateDeviceObjects();
     if (!bd->FontTexture)
         ImGui_ImplOpenGL2_CreateFontsTexture();
+#ifdef IMGUI_DPF_BACKEND
+    // The font atlas can be shared between several contexts, each with their own texture
+    else
+        ImGui::GetIO().Fonts->SetTexID((ImTextureID)(intptr_t)bd->FontTexture);
+#endif
+}
+
+#ifdef IMGUI_DPF_BACKEND
+// Setup the state DPF keeps in place while widgets draw, and which it expects to find again afterwards:
+// alpha-blending enabled, no face culling, no depth/stencil testing, no lighting, polygon fill, nothing bound.
+// RenderDrawData() only changes what imgui needs on top of this, so it is only set here after user callbacks asked for a reset.
+static void ImGui_ImplOpenGL2_SetupDefaultRenderState()
+{
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glDisable(GL_CULL_FACE);
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_STENCIL_TEST);
+    glDisable(GL_LIGHTING);
+    glDisable(GL_COLOR_MATERIAL);
+    glDisableClientState(GL_NORMAL_ARRAY);
+    glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+    glShadeModel(GL_SMOOTH);
+    glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
 }
+#endif
 
 static void ImGui_ImplOpenGL2_SetupRenderState(ImDrawData* draw_data, int fb_width, int fb_height)
 {
     // Setup render state: alpha-blending enabled, no face culling, no depth testing, scissor enabled, vertex/texcoord/color pointers, polygon fill.
+#ifndef IMGUI_DPF_BACKEND
     glEnable(GL_BLEND);
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+#else
+    // Most of it is DPF default state already, see ImGui_ImplOpenGL2_SetupDefaultRenderState()
+    // The cached frame needs correct alpha for compositing later, and is then composited with premultiplied alpha
+    ImGui_ImplOpenGL2_Data* bd = ImGui_ImplOpenGL2_GetBackendData();
+    if (bd->RenderingToCache)
+        bd->BlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    else if (bd->CompositingCache)
+        glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+#endif
     //glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA); // In order to composite our output buffer we need to preserve alpha
+#ifndef IMGUI_DPF_BACKEND
     glDisable(GL_CULL_FACE);
     glDisable(GL_DEPTH_TEST);
     glDisable(GL_STENCIL_TEST);
     glDisable(GL_LIGHTING);
     glDisable(GL_COLOR_MATERIAL);
+#endif
     glEnable(GL_SCISSOR_TEST);
     glEnableClientState(GL_VERTEX_ARRAY);
     glEnableClientState(GL_TEXTURE_COORD_ARRAY);
     glEnableClientState(GL_COLOR_ARRAY);
+#ifndef IMGUI_DPF_BACKEND
     glDisableClientState(GL_NORMAL_ARRAY);
+#endif
     glEnable(GL_TEXTURE_2D);
+#ifndef IMGUI_DPF_BACKEND
     glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
     glShadeModel(GL_SMOOTH);
     glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+#else
+    if (bd->HasVertexBuffers)
+    {
+        if (bd->VboHandle == 0)
+        {
+            bd->GenBuffers(1, &bd->VboHandle);
+            bd->GenBuffers(1, &bd->ElementsHandle);
+        }
+        bd->BindBuffer(GL_ARRAY_BUFFER, bd->VboHandle);
+        bd->BindBuffer(GL_ELEMENT_ARRAY_BUFFER, bd->ElementsHandle);
+    }
+#endif
 
 #ifndef IMGUI_DPF_BACKEND
     // If you are using this code with non-legacy OpenGL header/contexts (which you should not, prefer using imgui_impl_opengl3.cpp!!),
@@ -175,12 +487,172 @@ static void ImGui_ImplOpenGL2_SetupRenderState(ImDrawData* draw_data, int fb_wid
     glPushMatrix();
     glLoadIdentity();
 #else
-    IM_UNUSED(draw_data);
-    IM_UNUSED(fb_width);
-    IM_UNUSED(fb_height);
+    // DPF sets up viewport and projection for us, except when rendering into our own offscreen framebuffer
+    if (bd->RenderingToCache)
+    {
+        GL_CALL(glViewport(0, 0, (GLsizei)fb_width, (GLsizei)fb_height));
+        glMatrixMode(GL_PROJECTION);
+        glLoadIdentity();
+        glOrtho(0.0f, draw_data->DisplaySize.x, draw_data->DisplaySize.y, 0.0f, -1.0f, +1.0f);
+        glMatrixMode(GL_MODELVIEW);
+        glLoadIdentity();
+    }
+
+#ifdef IMGUI_DPF_COMPACT_DRAWVERT
+    // Compact vertices have fixed point positions and normalized texture coordinates (see ImDrawVert in imgui.h), scale them back.
+    // Modelview matrix is reloaded from the copy pushed by ImGui_ImplOpenGL2_RenderDrawData() first, as this is called again for ImDrawCallback_ResetRenderState.
+    glMatrixMode(GL_TEXTURE);
+    glLoadIdentity();
+    glScalef(1.0f / IMGUI_DPF_DRAWVERT_UV_SCALE, 1.0f / IMGUI_DPF_DRAWVERT_UV_SCALE, 1.0f);
+    glMatrixMode(GL_MODELVIEW);
+    if (!bd->RenderingToCache)
+    {
+        glPopMatrix();
+        glPushMatrix();
+    }
+    glScalef(1.0f / IMGUI_DPF_DRAWVERT_POS_SCALE, 1.0f / IMGUI_DPF_DRAWVERT_POS_SCALE, 1.0f);
+#endif
+#endif
+}
+
+#ifdef IMGUI_DPF_BACKEND
+// Upload font texture rows with glyphs that were rasterized since the last upload (full rows, so that the source data is contiguous)
+static void ImGui_ImplOpenGL2_UpdateFontsTexture()
+{
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    ImGui_ImplOpenGL2_Data* bd = ImGui_ImplOpenGL2_GetBackendData();
+    int y, height;
+    if (bd->FontTexture == 0 || atlas->TexPixelsRGBA32 == nullptr || !ImFontAtlasGetTexUpdateRows(atlas, bd->FontTextureVersion, &y, &height))
+        return;
+
+    // Texture binding is not restored, RenderDrawData() resets it to DPF default state at the end
+    glBindTexture(GL_TEXTURE_2D, bd->FontTexture);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, y, atlas->TexWidth, height, GL_RGBA, GL_UNSIGNED_BYTE, atlas->TexPixelsRGBA32 + y * atlas->TexWidth);
+    bd->StateCacheValid = false;
+    bd->FontTextureVersion = ImFontAtlasGetTexVersion(atlas);
+    bd->TextureUploads++;
+}
+
+// Upload user texture rows changed since the last frame, all at once through a pixel unpack buffer when available (full rows, so that the source data is contiguous)
+static void ImGui_ImplOpenGL2_UpdateUserTextures()
+{
+    ImGui_ImplOpenGL2_Data* bd = ImGui_ImplOpenGL2_GetBackendData();
+    ptrdiff_t upload_size = 0;
+    for (const ImGui_ImplOpenGL2_UserTexture& user_texture : bd->UserTextures)
+        if (user_texture.DirtyY0 < user_texture.DirtyY1)
+            upload_size += (ptrdiff_t)(user_texture.DirtyY1 - user_texture.DirtyY0) * user_texture.Width * 4;
+    if (upload_size == 0)
+        return;
+
+    if (bd->HasPixelBuffers)
+    {
+        // Orphan the buffer and copy all rows into it, texture uploads then read from it asynchronously
+        GLuint& pixel_buffer = bd->PixelBuffers[bd->PixelBufferIndex];
+        bd->PixelBufferIndex = (bd->PixelBufferIndex + 1) % IM_ARRAYSIZE(bd->PixelBuffers);
+        if (pixel_buffer == 0)
+            bd->GenBuffers(1, &pixel_buffer);
+        bd->BindBuffer(GL_PIXEL_UNPACK_BUFFER, pixel_buffer);
+        bd->BufferData(GL_PIXEL_UNPACK_BUFFER, upload_size, nullptr, GL_STREAM_DRAW);
+        ptrdiff_t offset = 0;
+        for (const ImGui_ImplOpenGL2_UserTexture& user_texture : bd->UserTextures)
+        {
+            if (user_texture.DirtyY0 >= user_texture.DirtyY1)
+                continue;
+            const ptrdiff_t size = (ptrdiff_t)(user_texture.DirtyY1 - user_texture.DirtyY0) * user_texture.Width * 4;
+            bd->BufferSubData(GL_PIXEL_UNPACK_BUFFER, offset, size, user_texture.Pixels + user_texture.DirtyY0 * user_texture.Width * 4);
+            offset += size;
+        }
+    }
+
+    // Texture binding is not restored, RenderDrawData() resets it to DPF default state at the end
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    ptrdiff_t offset = 0;
+    for (ImGui_ImplOpenGL2_UserTexture& user_texture : bd->UserTextures)
+    {
+        if (user_texture.DirtyY0 >= user_texture.DirtyY1)
+            continue;
+        const int height = user_texture.DirtyY1 - user_texture.DirtyY0;
+        const void* pixels = bd->HasPixelBuffers ? (const void*)(intptr_t)offset : (const void*)(user_texture.Pixels + user_texture.DirtyY0 * user_texture.Width * 4);
+        glBindTexture(GL_TEXTURE_2D, user_texture.Texture);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, user_texture.DirtyY0, user_texture.Width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+        offset += (ptrdiff_t)height * user_texture.Width * 4;
+        user_texture.DirtyY0 = user_texture.DirtyY1 = 0;
+        bd->TextureUploads++;
+    }
+
+    if (bd->HasPixelBuffers)
+        bd->BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    bd->StateCacheValid = false;
+}
 #endif
+
+#ifdef IMGUI_DPF_BACKEND
+// Upload the vertex/index data of all draw lists packed one after the other, with a single glBufferData() call per buffer (which must be bound)
+static void ImGui_ImplOpenGL2_UploadDrawData(ImDrawData* draw_data)
+{
+    ImGui_ImplOpenGL2_Data* bd = ImGui_ImplOpenGL2_GetBackendData();
+    if (draw_data->CmdListsCount == 1)
+    {
+        const ImDrawList* draw_list = draw_data->CmdLists[0];
+        bd->BufferData(GL_ARRAY_BUFFER, draw_list->VtxBuffer.size_in_bytes(), draw_list->VtxBuffer.Data, GL_STREAM_DRAW);
+        bd->BufferData(GL_ELEMENT_ARRAY_BUFFER, draw_list->IdxBuffer.size_in_bytes(), draw_list->IdxBuffer.Data, GL_STREAM_DRAW);
+        return;
+    }
+
+    ImVector<char>& staging = bd->UploadBuffer;
+    staging.resize(draw_data->TotalVtxCount * (int)sizeof(ImDrawVert));
+    char* dst = staging.Data;
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        memcpy(dst, draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.size_in_bytes());
+        dst += draw_list->VtxBuffer.size_in_bytes();
+    }
+    bd->BufferData(GL_ARRAY_BUFFER, staging.Size, staging.Data, GL_STREAM_DRAW);
+
+    staging.resize(draw_data->TotalIdxCount * (int)sizeof(ImDrawIdx));
+    dst = staging.Data;
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        memcpy(dst, draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.size_in_bytes());
+        dst += draw_list->IdxBuffer.size_in_bytes();
+    }
+    bd->BufferData(GL_ELEMENT_ARRAY_BUFFER, staging.Size, staging.Data, GL_STREAM_DRAW);
+}
+
+// Intersect a scissor box with the damaged region of the cached frame, returns false if nothing is left to draw
+static bool ImGui_ImplOpenGL2_ClipToDamageBox(ImGui_ImplOpenGL2_Data* bd, GLint scissor_box[4])
+{
+    const GLint x0 = ImMax(scissor_box[0], bd->CacheDamageBox[0]);
+    const GLint y0 = ImMax(scissor_box[1], bd->CacheDamageBox[1]);
+    const GLint x1 = ImMin(scissor_box[0] + scissor_box[2], bd->CacheDamageBox[0] + bd->CacheDamageBox[2]);
+    const GLint y1 = ImMin(scissor_box[1] + scissor_box[3], bd->CacheDamageBox[1] + bd->CacheDamageBox[3]);
+    if (x1 <= x0 || y1 <= y0)
+        return false;
+    scissor_box[0] = x0;
+    scissor_box[1] = y0;
+    scissor_box[2] = x1 - x0;
+    scissor_box[3] = y1 - y0;
+    return true;
 }
 
+// Apply scissor rectangle and texture of a draw command, skipping whatever is the same as for the previous one
+static void ImGui_ImplOpenGL2_SetupDrawState(ImGui_ImplOpenGL2_Data* bd, const GLint scissor_box[4], GLuint texture)
+{
+    if (!bd->StateCacheValid || memcmp(bd->ScissorBox, scissor_box, sizeof(bd->ScissorBox)) != 0)
+    {
+        glScissor(scissor_box[0], scissor_box[1], (GLsizei)scissor_box[2], (GLsizei)scissor_box[3]);
+        memcpy(bd->ScissorBox, scissor_box, sizeof(bd->ScissorBox));
+    }
+    if (!bd->StateCacheValid || bd->BoundTexture != texture)
+    {
+        glBindTexture(GL_TEXTURE_2D, texture);
+        bd->BoundTexture = texture;
+    }
+    bd->StateCacheValid = true;
+}
+#endif
+
 // OpenGL2 Render function.
 // Note that this implementation is little overcomplicated because we are saving/setting up/restoring every OpenGL state explicitly.
 // This is in order to be able to run within an OpenGL engine that doesn't do so.
@@ -192,6 +664,18 @@ void ImGui_ImplOpenGL2_RenderDrawData(ImDrawData* draw_data)
     if (fb_width == 0 || fb_height == 0)
         return;
 
+#ifdef IMGUI_DPF_BACKEND
+    // DPF owns the GL context and calls us with its default state in place (see ImGui_ImplOpenGL2_SetupDefaultRenderState()),
+    // so instead of querying and restoring all GL state, only what imgui needs on top of it is set here and reverted at the end.
+    ImGui_ImplOpenGL2_Data* bd = ImGui_ImplOpenGL2_GetBackendData();
+    bd->StateCacheValid = false;
+    ImGui_ImplOpenGL2_UpdateFontsTexture();
+    ImGui_ImplOpenGL2_UpdateUserTextures();
+#ifdef IMGUI_DPF_COMPACT_DRAWVERT
+    glMatrixMode(GL_MODELVIEW);
+    glPushMatrix();
+#endif
+#else
     // Backup GL state
     GLint last_texture; glGetIntegerv(GL_TEXTURE_BINDING_2D, &last_texture);
     GLint last_polygon_mode[2]; glGetIntegerv(GL_POLYGON_MODE, last_polygon_mode);
@@ -200,6 +684,7 @@ void ImGui_ImplOpenGL2_RenderDrawData(ImDrawData* draw_data)
     GLint last_shade_model; glGetIntegerv(GL_SHADE_MODEL, &last_shade_model);
     GLint last_tex_env_mode; glGetTexEnviv(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, &last_tex_env_mode);
     glPushAttrib(GL_ENABLE_BIT | GL_COLOR_BUFFER_BIT | GL_TRANSFORM_BIT);
+#endif
 
     // Setup desired GL state
     ImGui_ImplOpenGL2_SetupRenderState(draw_data, fb_width, fb_height);
@@ -207,15 +692,41 @@ void ImGui_ImplOpenGL2_RenderDrawData(ImDrawData* draw_data)
     // Will project scissor/clipping rectangles into framebuffer space
     ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
     ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
+#ifdef IMGUI_DPF_BACKEND
+    if (bd->RenderingToCache)
+        clip_off = ImVec2(0.0f, 0.0f);
+
+    // Upload all draw lists at once into vertex buffer objects when available, instead of the driver copying client arrays on every draw call.
+    // Pointers below are then byte offsets into those buffers.
+    intptr_t vtx_buffer_offset = 0;
+    intptr_t idx_buffer_offset = 0;
+    if (bd->HasVertexBuffers)
+        ImGui_ImplOpenGL2_UploadDrawData(draw_data);
+#endif
 
     // Render command lists
     for (int n = 0; n < draw_data->CmdListsCount; n++)
     {
         const ImDrawList* draw_list = draw_data->CmdLists[n];
+#ifdef IMGUI_DPF_BACKEND
+        if (n != 0)
+        {
+            vtx_buffer_offset += draw_data->CmdLists[n - 1]->VtxBuffer.size_in_bytes();
+            idx_buffer_offset += draw_data->CmdLists[n - 1]->IdxBuffer.size_in_bytes();
+        }
+        const ImDrawVert* vtx_buffer = bd->HasVertexBuffers ? (const ImDrawVert*)vtx_buffer_offset : draw_list->VtxBuffer.Data;
+        const ImDrawIdx* idx_buffer = bd->HasVertexBuffers ? (const ImDrawIdx*)idx_buffer_offset : draw_list->IdxBuffer.Data;
+#else
         const ImDrawVert* vtx_buffer = draw_list->VtxBuffer.Data;
         const ImDrawIdx* idx_buffer = draw_list->IdxBuffer.Data;
+#endif
+#ifdef IMGUI_DPF_COMPACT_DRAWVERT
+        glVertexPointer(2, GL_SHORT, sizeof(ImDrawVert), (const GLvoid*)((const char*)vtx_buffer + offsetof(ImDrawVert, pos)));
+        glTexCoordPointer(2, GL_SHORT, sizeof(ImDrawVert), (const GLvoid*)((const char*)vtx_buffer + offsetof(ImDrawVert, uv)));
+#else
         glVertexPointer(2, GL_FLOAT, sizeof(ImDrawVert), (const GLvoid*)((const char*)vtx_buffer + offsetof(ImDrawVert, pos)));
         glTexCoordPointer(2, GL_FLOAT, sizeof(ImDrawVert), (const GLvoid*)((const char*)vtx_buffer + offsetof(ImDrawVert, uv)));
+#endif
         glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(ImDrawVert), (const GLvoid*)((const char*)vtx_buffer + offsetof(ImDrawVert, col)));
 
         for (int cmd_i = 0; cmd_i < draw_list->CmdBuffer.Size; cmd_i++)
@@ -226,9 +737,17 @@ void ImGui_ImplOpenGL2_RenderDrawData(ImDrawData* draw_data)
                 // User callback, registered via ImDrawList::AddCallback()
                 // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
                 if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
+                {
+#ifdef IMGUI_DPF_BACKEND
+                    ImGui_ImplOpenGL2_SetupDefaultRenderState();
+#endif
                     ImGui_ImplOpenGL2_SetupRenderState(draw_data, fb_width, fb_height);
+                }
                 else
                     pcmd->UserCallback(draw_list, pcmd);
+#ifdef IMGUI_DPF_BACKEND
+                bd->StateCacheValid = false;
+#endif
             }
             else
             {
@@ -238,11 +757,19 @@ void ImGui_ImplOpenGL2_RenderDrawData(ImDrawData* draw_data)
                 if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
                     continue;
 
+#ifdef IMGUI_DPF_BACKEND
+                // Apply scissor/clipping rectangle (Y is inverted in OpenGL) and bind texture, if changed, Draw
+                GLint scissor_box[4] = { (int)clip_min.x, (int)((float)fb_height - clip_max.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y) };
+                if (bd->UseCacheDamageBox && !ImGui_ImplOpenGL2_ClipToDamageBox(bd, scissor_box))
+                    continue;
+                ImGui_ImplOpenGL2_SetupDrawState(bd, scissor_box, (GLuint)(intptr_t)pcmd->GetTexID());
+#else
                 // Apply scissor/clipping rectangle (Y is inverted in OpenGL)
                 glScissor((int)clip_min.x, (int)((float)fb_height - clip_max.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y));
 
                 // Bind texture, Draw
                 glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->GetTexID());
+#endif
                 glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, idx_buffer + pcmd->IdxOffset);
             }
         }
@@ -252,6 +779,25 @@ void ImGui_ImplOpenGL2_RenderDrawData(ImDrawData* draw_data)
     glDisableClientState(GL_COLOR_ARRAY);
     glDisableClientState(GL_TEXTURE_COORD_ARRAY);
     glDisableClientState(GL_VERTEX_ARRAY);
+#ifdef IMGUI_DPF_BACKEND
+    // Back to DPF default state
+    glBindTexture(GL_TEXTURE_2D, 0);
+    if (bd->HasVertexBuffers)
+    {
+        bd->BindBuffer(GL_ARRAY_BUFFER, 0);
+        bd->BindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    }
+    glDisable(GL_TEXTURE_2D);
+    glDisable(GL_SCISSOR_TEST);
+    if (bd->RenderingToCache || bd->CompositingCache)
+        glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+#ifdef IMGUI_DPF_COMPACT_DRAWVERT
+    glMatrixMode(GL_TEXTURE);
+    glLoadIdentity();
+    glMatrixMode(GL_MODELVIEW);
+    glPopMatrix();
+#endif
+#else
     glBindTexture(GL_TEXTURE_2D, (GLuint)last_texture);
     glMatrixMode(GL_MODELVIEW);
     glPopMatrix();
@@ -263,7 +809,179 @@ void ImGui_ImplOpenGL2_RenderDrawData(ImDrawData* draw_data)
     glScissor(last_scissor_box[0], last_scissor_box[1], (GLsizei)last_scissor_box[2], (GLsizei)last_scissor_box[3]);
     glShadeModel(last_shade_model);
     glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, last_tex_env_mode);
+#endif
+}
+
+#ifdef IMGUI_DPF_BACKEND
+// (Re)create the offscreen framebuffer used for caching frames, if needed
+static bool ImGui_ImplOpenGL2_UpdateCache(int fb_width, int fb_height)
+{
+    ImGui_ImplOpenGL2_Data* bd = ImGui_ImplOpenGL2_GetBackendData();
+    if (!bd->HasFramebuffers)
+        return false;
+    if (bd->CacheFramebuffer != 0 && bd->CacheWidth == fb_width && bd->CacheHeight == fb_height)
+        return true;
+
+    if (bd->CacheTexture == 0)
+        glGenTextures(1, &bd->CacheTexture);
+    glBindTexture(GL_TEXTURE_2D, bd->CacheTexture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, fb_width, fb_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+    if (bd->CacheFramebuffer == 0)
+        bd->GenFramebuffers(1, &bd->CacheFramebuffer);
+    bd->BindFramebuffer(GL_FRAMEBUFFER, bd->CacheFramebuffer);
+    bd->FramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, bd->CacheTexture, 0);
+    const bool complete = bd->CheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+
+    // DPF draws into the default framebuffer, and keeps no texture bound
+    bd->BindFramebuffer(GL_FRAMEBUFFER, 0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    bd->CacheValid = false;
+
+    if (!complete)
+    {
+        ImGui_ImplOpenGL2_DestroyCache();
+        bd->HasFramebuffers = false;
+        return false;
+    }
+
+    bd->CacheWidth = fb_width;
+    bd->CacheHeight = fb_height;
+    return true;
+}
+
+void ImGui_ImplOpenGL2_RenderDrawDataToCache(ImDrawData* draw_data, const ImVec4* damage_rect)
+{
+    int fb_width = (int)(draw_data->DisplaySize.x * draw_data->FramebufferScale.x);
+    int fb_height = (int)(draw_data->DisplaySize.y * draw_data->FramebufferScale.y);
+    if (fb_width == 0 || fb_height == 0)
+        return;
+
+    // Fallback to regular rendering if offscreen framebuffers are not usable
+    if (!ImGui_ImplOpenGL2_UpdateCache(fb_width, fb_height))
+    {
+        ImGui_ImplOpenGL2_RenderDrawData(draw_data);
+        return;
+    }
+
+    ImGui_ImplOpenGL2_Data* bd = ImGui_ImplOpenGL2_GetBackendData();
+
+    // Only the damaged region needs to be rendered again while the previous frame is still in the cache
+    bd->UseCacheDamageBox = damage_rect != nullptr && bd->CacheValid;
+    if (bd->UseCacheDamageBox)
+    {
+        const ImVec2 scale = draw_data->FramebufferScale;
+        const int x0 = ImClamp((int)ImFloor(damage_rect->x * scale.x), 0, fb_width);
+        const int y0 = ImClamp((int)ImFloor(damage_rect->y * scale.y), 0, fb_height);
+        const int x1 = ImClamp((int)ImCeil(damage_rect->z * scale.x), x0, fb_width);
+        const int y1 = ImClamp((int)ImCeil(damage_rect->w * scale.y), y0, fb_height);
+        bd->CacheDamageBox[0] = x0;
+        bd->CacheDamageBox[1] = fb_height - y1;
+        bd->CacheDamageBox[2] = x1 - x0;
+        bd->CacheDamageBox[3] = y1 - y0;
+    }
+
+    // DPF sets its own clear color before clearing, and scissor test is left disabled by RenderDrawData() anyway when clearing everything
+    bd->BindFramebuffer(GL_FRAMEBUFFER, bd->CacheFramebuffer);
+    if (bd->UseCacheDamageBox)
+    {
+        glEnable(GL_SCISSOR_TEST);
+        glScissor(bd->CacheDamageBox[0], bd->CacheDamageBox[1], bd->CacheDamageBox[2], bd->CacheDamageBox[3]);
+    }
+    else
+    {
+        glDisable(GL_SCISSOR_TEST);
+    }
+    glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    // Viewport and projection are setup by ImGui_ImplOpenGL2_SetupRenderState() for this case, keep DPF ones intact
+    glPushAttrib(GL_VIEWPORT_BIT);
+    glMatrixMode(GL_PROJECTION);
+    glPushMatrix();
+    glMatrixMode(GL_MODELVIEW);
+    glPushMatrix();
+
+    bd->RenderingToCache = true;
+    ImGui_ImplOpenGL2_RenderDrawData(draw_data);
+    bd->RenderingToCache = false;
+    bd->UseCacheDamageBox = false;
+    bd->CacheValid = true;
+
+    glMatrixMode(GL_MODELVIEW);
+    glPopMatrix();
+    glMatrixMode(GL_PROJECTION);
+    glPopMatrix();
+    glMatrixMode(GL_MODELVIEW);
+    glPopAttrib();
+
+    bd->BindFramebuffer(GL_FRAMEBUFFER, 0);
+    ImGui_ImplOpenGL2_RenderCachedDrawData(draw_data);
+}
+
+bool ImGui_ImplOpenGL2_RenderCachedDrawData(ImDrawData* draw_data)
+{
+    ImGui_ImplOpenGL2_Data* bd = ImGui_ImplOpenGL2_GetBackendData();
+    int fb_width = (int)(draw_data->DisplaySize.x * draw_data->FramebufferScale.x);
+    int fb_height = (int)(draw_data->DisplaySize.y * draw_data->FramebufferScale.y);
+    if (!bd->CacheValid || bd->CacheWidth != fb_width || bd->CacheHeight != fb_height)
+        return false;
+
+    if (bd->CacheDrawList == nullptr)
+        bd->CacheDrawList = IM_NEW(ImDrawList)(nullptr);
+
+    // Single quad covering the whole display, framebuffer contents are upside-down compared to ImGui coordinates
+    const float w = draw_data->DisplaySize.x;
+    const float h = draw_data->DisplaySize.y;
+    ImDrawList* draw_list = bd->CacheDrawList;
+    draw_list->VtxBuffer.resize(4);
+    draw_list->IdxBuffer.resize(6);
+    draw_list->CmdBuffer.resize(1);
+    ImDrawVert* vtx = draw_list->VtxBuffer.Data;
+    vtx[0].pos = ImVec2(0.0f, 0.0f); vtx[0].uv = ImVec2(0.0f, 1.0f); vtx[0].col = IM_COL32_WHITE;
+    vtx[1].pos = ImVec2(w, 0.0f);    vtx[1].uv = ImVec2(1.0f, 1.0f); vtx[1].col = IM_COL32_WHITE;
+    vtx[2].pos = ImVec2(w, h);       vtx[2].uv = ImVec2(1.0f, 0.0f); vtx[2].col = IM_COL32_WHITE;
+    vtx[3].pos = ImVec2(0.0f, h);    vtx[3].uv = ImVec2(0.0f, 0.0f); vtx[3].col = IM_COL32_WHITE;
+    ImDrawIdx* idx = draw_list->IdxBuffer.Data;
+    idx[0] = 0; idx[1] = 1; idx[2] = 2;
+    idx[3] = 0; idx[4] = 2; idx[5] = 3;
+    ImDrawCmd cmd;
+    cmd.ClipRect = ImVec4(0.0f, 0.0f, w, h);
+    cmd.TextureId = (ImTextureID)(intptr_t)bd->CacheTexture;
+    cmd.ElemCount = 6;
+    draw_list->CmdBuffer[0] = cmd;
+
+    ImDrawData cache_draw_data;
+    cache_draw_data.Valid = true;
+    cache_draw_data.CmdLists.push_back(draw_list);
+    cache_draw_data.CmdListsCount = 1;
+    cache_draw_data.TotalVtxCount = 4;
+    cache_draw_data.TotalIdxCount = 6;
+    cache_draw_data.DisplayPos = draw_data->DisplayPos;
+    cache_draw_data.DisplaySize = draw_data->DisplaySize;
+    cache_draw_data.FramebufferScale = draw_data->FramebufferScale;
+
+    bd->CompositingCache = true;
+    ImGui_ImplOpenGL2_RenderDrawData(&cache_draw_data);
+    bd->CompositingCache = false;
+    return true;
+}
+
+void ImGui_ImplOpenGL2_DestroyCache()
+{
+    ImGui_ImplOpenGL2_Data* bd = ImGui_ImplOpenGL2_GetBackendData();
+    if (bd->CacheFramebuffer) { bd->DeleteFramebuffers(1, &bd->CacheFramebuffer); bd->CacheFramebuffer = 0; }
+    if (bd->CacheTexture)     { glDeleteTextures(1, &bd->CacheTexture); bd->CacheTexture = 0; }
+    if (bd->CacheDrawList)    { IM_DELETE(bd->CacheDrawList); bd->CacheDrawList = nullptr; }
+    bd->CacheWidth = bd->CacheHeight = 0;
+    bd->CacheValid = false;
 }
+#endif
 
 bool ImGui_ImplOpenGL2_CreateFontsTexture()
 {
@@ -289,6 +1007,10 @@ bool ImGui_ImplOpenGL2_CreateFontsTexture()
 
     // Store our identifier
     io.Fonts->SetTexID((ImTextureID)(intptr_t)bd->FontTexture);
+#ifdef IMGUI_DPF_BACKEND
+    bd->FontTextureVersion = ImFontAtlasGetTexVersion(io.Fonts);
+    bd->TextureUploads++;
+#endif
 
     // Restore state
     glBindTexture(GL_TEXTURE_2D, last_texture);
@@ -308,6 +1030,164 @@ void ImGui_ImplOpenGL2_DestroyFontsTexture()
     }
 }
 
+#ifdef IMGUI_DPF_BACKEND
+ImTextureID ImGui_ImplOpenGL2_ReleaseFontsTexture()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui_ImplOpenGL2_Data* bd = ImGui_ImplOpenGL2_GetBackendData();
+    const ImTextureID texture = (ImTextureID)(intptr_t)bd->FontTexture;
+    io.Fonts->SetTexID(0);
+    bd->FontTexture = 0;
+    return texture;
+}
+
+void ImGui_ImplOpenGL2_SetFontsTexture(ImTextureID texture)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui_ImplOpenGL2_Data* bd = ImGui_ImplOpenGL2_GetBackendData();
+    ImGui_ImplOpenGL2_DestroyFontsTexture();
+    bd->FontTexture = (GLuint)(intptr_t)texture;
+    bd->FontTextureVersion = 0; // Not known, upload all dynamic glyphs again
+    io.Fonts->SetTexID(texture);
+}
+
+void ImGui_ImplOpenGL2_DestroyTexture(ImTextureID texture)
+{
+    GLuint gl_texture = (GLuint)(intptr_t)texture;
+    glDeleteTextures(1, &gl_texture);
+}
+
+static ImGui_ImplOpenGL2_UserTexture* ImGui_ImplOpenGL2_FindUserTexture(ImGui_ImplOpenGL2_Data* bd, ImTextureID texture)
+{
+    for (ImGui_ImplOpenGL2_UserTexture& user_texture : bd->UserTextures)
+        if (user_texture.Texture == (GLuint)(intptr_t)texture)
+            return &user_texture;
+    return nullptr;
+}
+
+ImTextureID ImGui_ImplOpenGL2_CreateUserTexture(int width, int height)
+{
+    ImGui_ImplOpenGL2_Data* bd = ImGui_ImplOpenGL2_GetBackendData();
+    IM_ASSERT(width > 0 && height > 0);
+
+    ImGui_ImplOpenGL2_UserTexture user_texture;
+    user_texture.Width = width;
+    user_texture.Height = height;
+    user_texture.Pixels = (unsigned char*)IM_ALLOC((size_t)width * height * 4);
+    user_texture.DirtyY0 = user_texture.DirtyY1 = 0;
+    memset(user_texture.Pixels, 0, (size_t)width * height * 4);
+
+    // Texture binding is not restored, RenderDrawData() sets what it needs
+    glGenTextures(1, &user_texture.Texture);
+    glBindTexture(GL_TEXTURE_2D, user_texture.Texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, user_texture.Pixels);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    bd->StateCacheValid = false;
+
+    bd->UserTextures.push_back(user_texture);
+    return (ImTextureID)(intptr_t)user_texture.Texture;
+}
+
+void ImGui_ImplOpenGL2_UpdateUserTexture(ImTextureID texture, int x, int y, int width, int height, const void* pixels, int pitch)
+{
+    ImGui_ImplOpenGL2_Data* bd = ImGui_ImplOpenGL2_GetBackendData();
+    ImGui_ImplOpenGL2_UserTexture* user_texture = ImGui_ImplOpenGL2_FindUserTexture(bd, texture);
+    IM_ASSERT(user_texture != nullptr && "Texture was not created with ImGui_ImplOpenGL2_CreateUserTexture()");
+    IM_ASSERT(x >= 0 && y >= 0 && width > 0 && height > 0 && x + width <= user_texture->Width && y + height <= user_texture->Height);
+    if (user_texture == nullptr || x < 0 || y < 0 || width <= 0 || height <= 0 || x + width > user_texture->Width || y + height > user_texture->Height)
+        return;
+
+    if (pitch == 0)
+        pitch = width * 4;
+    for (int row = 0; row < height; ++row)
+        memcpy(user_texture->Pixels + ((y + row) * user_texture->Width + x) * 4, (const unsigned char*)pixels + row * pitch, (size_t)width * 4);
+
+    if (user_texture->DirtyY0 < user_texture->DirtyY1)
+    {
+        user_texture->DirtyY0 = ImMin(user_texture->DirtyY0, y);
+        user_texture->DirtyY1 = ImMax(user_texture->DirtyY1, y + height);
+    }
+    else
+    {
+        user_texture->DirtyY0 = y;
+        user_texture->DirtyY1 = y + height;
+    }
+}
+
+void ImGui_ImplOpenGL2_DestroyUserTexture(ImTextureID texture)
+{
+    ImGui_ImplOpenGL2_Data* bd = ImGui_ImplOpenGL2_GetBackendData();
+    ImGui_ImplOpenGL2_UserTexture* user_texture = ImGui_ImplOpenGL2_FindUserTexture(bd, texture);
+    IM_ASSERT(user_texture != nullptr && "Texture was not created with ImGui_ImplOpenGL2_CreateUserTexture()");
+    if (user_texture == nullptr)
+        return;
+
+    glDeleteTextures(1, &user_texture->Texture);
+    IM_FREE(user_texture->Pixels);
+    bd->UserTextures.erase(user_texture);
+    bd->StateCacheValid = false;
+}
+
+int ImGui_ImplOpenGL2_GetTextureUploadCount()
+{
+    ImGui_ImplOpenGL2_Data* bd = ImGui_ImplOpenGL2_GetBackendData();
+    return bd != nullptr ? bd->TextureUploads : 0;
+}
+
+bool ImGui_ImplOpenGL2_BeginGpuTimer(int tag)
+{
+    ImGui_ImplOpenGL2_Data* bd = ImGui_ImplOpenGL2_GetBackendData();
+    IM_ASSERT(bd != nullptr && !bd->TimerQueryActive);
+
+    // Skip measuring rather than waiting when the GPU is that far behind
+    if (!bd->HasTimerQueries || bd->TimerQueryCount == IMGUI_IMPL_OPENGL_TIMER_QUERIES)
+        return false;
+
+    if (bd->TimerQueries[0] == 0)
+        bd->GenQueries(IMGUI_IMPL_OPENGL_TIMER_QUERIES, bd->TimerQueries);
+
+    const int index = (bd->TimerQueryFirst + bd->TimerQueryCount) % IMGUI_IMPL_OPENGL_TIMER_QUERIES;
+    bd->TimerQueryTags[index] = tag;
+    bd->TimerQueryActive = true;
+    bd->BeginQuery(GL_TIME_ELAPSED, bd->TimerQueries[index]);
+    return true;
+}
+
+void ImGui_ImplOpenGL2_EndGpuTimer()
+{
+    ImGui_ImplOpenGL2_Data* bd = ImGui_ImplOpenGL2_GetBackendData();
+    IM_ASSERT(bd != nullptr && bd->TimerQueryActive);
+
+    bd->EndQuery(GL_TIME_ELAPSED);
+    bd->TimerQueryActive = false;
+    ++bd->TimerQueryCount;
+}
+
+bool ImGui_ImplOpenGL2_GetGpuTimerResult(int* tag, double* milliseconds)
+{
+    ImGui_ImplOpenGL2_Data* bd = ImGui_ImplOpenGL2_GetBackendData();
+    if (bd == nullptr || bd->TimerQueryCount == 0)
+        return false;
+
+    const GLuint query = bd->TimerQueries[bd->TimerQueryFirst];
+    GLint available = 0;
+    bd->GetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available)
+        return false;
+
+    ImU64 nanoseconds = 0;
+    bd->GetQueryObjectui64v(query, GL_QUERY_RESULT, &nanoseconds);
+    *tag = bd->TimerQueryTags[bd->TimerQueryFirst];
+    *milliseconds = (double)nanoseconds / 1000000.0;
+    bd->TimerQueryFirst = (bd->TimerQueryFirst + 1) % IMGUI_IMPL_OPENGL_TIMER_QUERIES;
+    --bd->TimerQueryCount;
+    return true;
+}
+#endif
+
 bool    ImGui_ImplOpenGL2_CreateDeviceObjects()
 {
     return ImGui_ImplOpenGL2_CreateFontsTexture();
@@ -315,6 +1195,13 @@ bool    ImGui_ImplOpenGL2_CreateDeviceObjects()
 
 void    ImGui_ImplOpenGL2_DestroyDeviceObjects()
 {
+#ifdef IMGUI_DPF_BACKEND
+    ImGui_ImplOpenGL2_Data* bd = ImGui_ImplOpenGL2_GetBackendData();
+    if (bd->VboHandle)      { bd->DeleteBuffers(1, &bd->VboHandle); bd->VboHandle = 0; }
+    if (bd->ElementsHandle) { bd->DeleteBuffers(1, &bd->ElementsHandle); bd->ElementsHandle = 0; }
+    bd->UploadBuffer.clear();
+    ImGui_ImplOpenGL2_DestroyCache();
+#endif
     ImGui_ImplOpenGL2_DestroyFontsTexture();
 }
 
@@ -38,4 +38,33 @@ IMGUI_IMPL_API void     ImGui_ImplOpenGL2_DestroyFontsTexture();
 IMGUI_IMPL_API bool     ImGui_ImplOpenGL2_CreateDeviceObjects();
 IMGUI_IMPL_API void     ImGui_ImplOpenGL2_DestroyDeviceObjects();
 
+#ifdef IMGUI_DPF_BACKEND
+// DPF additions: render into an offscreen framebuffer, so that the same frame can be composited again without re-rendering it.
+// RenderCachedDrawData() returns false if there is no cached frame matching the draw data size, call RenderDrawDataToCache() in that case.
+// RenderDrawDataToCache() can be given the region that changed since the previous frame (in ImGui coordinates), only that part of the cached frame is then rendered again.
+IMGUI_IMPL_API void     ImGui_ImplOpenGL2_RenderDrawDataToCache(ImDrawData* draw_data, const ImVec4* damage_rect = nullptr);
+IMGUI_IMPL_API bool     ImGui_ImplOpenGL2_RenderCachedDrawData(ImDrawData* draw_data);
+IMGUI_IMPL_API void     ImGui_ImplOpenGL2_DestroyCache();
+// DPF additions: keep font textures around while switching between font atlases.
+// ReleaseFontsTexture() detaches the current font texture without destroying it, SetFontsTexture() uses it again once io.Fonts is back to its atlas.
+IMGUI_IMPL_API ImTextureID ImGui_ImplOpenGL2_ReleaseFontsTexture();
+IMGUI_IMPL_API void     ImGui_ImplOpenGL2_SetFontsTexture(ImTextureID texture);
+IMGUI_IMPL_API void     ImGui_ImplOpenGL2_DestroyTexture(ImTextureID texture);
+// DPF additions: RGBA user textures (for ImGui::Image()) with a copy of their pixels kept around.
+// UpdateUserTexture() only changes that copy, and can be called without the GL context being current (pitch is in bytes, 0 for tightly packed rows).
+// The changed rows are uploaded by the next RenderDrawData() call, through alternating pixel unpack buffers when available.
+IMGUI_IMPL_API ImTextureID ImGui_ImplOpenGL2_CreateUserTexture(int width, int height);
+IMGUI_IMPL_API void     ImGui_ImplOpenGL2_UpdateUserTexture(ImTextureID texture, int x, int y, int width, int height, const void* pixels, int pitch = 0);
+IMGUI_IMPL_API void     ImGui_ImplOpenGL2_DestroyUserTexture(ImTextureID texture);
+// DPF additions: total number of texture uploads done by the backend, for profiling.
+IMGUI_IMPL_API int      ImGui_ImplOpenGL2_GetTextureUploadCount();
+// DPF additions: GPU timer queries, measuring the GPU time spent on commands issued between BeginGpuTimer() and EndGpuTimer().
+// A few queries are kept in flight and results are only read once available, so the GPU is never waited for.
+// BeginGpuTimer() returns false if timer queries are not supported (GL 3.3, GL_ARB_timer_query or GL_EXT_timer_query are needed) or all of them are still in flight, EndGpuTimer() must not be called in that case.
+// GetGpuTimerResult() returns the oldest available result together with the tag it was started with, or false if there is none yet.
+IMGUI_IMPL_API bool     ImGui_ImplOpenGL2_BeginGpuTimer(int tag);
+IMGUI_IMPL_API void     ImGui_ImplOpenGL2_EndGpuTimer();
+IMGUI_IMPL_API bool     ImGui_ImplOpenGL2_GetGpuTimerResult(int* tag, double* milliseconds);
+#endif
+
 #endif // #ifndef IMGUI_DISABLE
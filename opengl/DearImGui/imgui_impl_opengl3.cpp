@@ -117,6 +117,9 @@
 #include "imgui.h"
 #ifndef IMGUI_DISABLE
 #include "imgui_impl_opengl3.h"
+#ifdef IMGUI_DPF_BACKEND
+#include "imgui_internal.h"     // ImFontAtlasGetTexUpdateRows()
+#endif
 #include <stdio.h>
 #include <stdint.h>     // intptr_t
 #if defined(__APPLE__)
@@ -212,6 +215,53 @@
 #define IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
 #endif
 
+// DPF: Desktop GL 3.2+ and GL ES 3.0+ have glMapBufferRange() and fences, used for streaming vertex data through a ring buffer
+#if defined(IMGUI_DPF_BACKEND) && !defined(IMGUI_IMPL_OPENGL_ES2) && (defined(IMGUI_IMPL_OPENGL_ES3) || defined(GL_VERSION_3_2))
+#define IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STREAMING
+#define IMGUI_IMPL_OPENGL_STREAM_SEGMENTS 3     // Number of RenderDrawData() calls that can be in flight before having to wait for the GPU
+#endif
+
+// DPF: Desktop GL 4.1+ (or GL_ARB_get_program_binary) and GL ES 3.0+ have glGetProgramBinary(), used for caching the linked shader program
+#if defined(IMGUI_DPF_BACKEND) && !defined(IMGUI_IMPL_OPENGL_ES2) && (defined(IMGUI_IMPL_OPENGL_ES3) || defined(GL_VERSION_4_1))
+#define IMGUI_IMPL_OPENGL_MAY_HAVE_PROGRAM_BINARY
+#endif
+
+// DPF: Program binary files are replaced in place, which rename() does not do on Windows
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_PROGRAM_BINARY
+#if defined(_WIN32) && !defined(IMGUI_DISABLE_WIN32_FUNCTIONS) && (defined(__MINGW32__) || (!defined(__CYGWIN__) && !defined(__GNUC__)))
+#define IMGUI_IMPL_OPENGL_USE_WIN32_MOVE_FILE
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>            // MoveFileExW()
+#endif
+#ifdef _WIN32
+#include <process.h>            // _getpid()
+#else
+#include <unistd.h>             // getpid()
+#endif
+#endif
+
+// DPF: Desktop GL 3.3+ (or GL_ARB_timer_query) has GL_TIME_ELAPSED queries, used for measuring GPU time when profiling
+#if defined(IMGUI_DPF_BACKEND) && !defined(IMGUI_IMPL_OPENGL_ES2) && !defined(IMGUI_IMPL_OPENGL_ES3) && defined(GL_VERSION_3_3)
+#define IMGUI_IMPL_OPENGL_MAY_HAVE_TIMER_QUERY
+#define IMGUI_IMPL_OPENGL_TIMER_QUERIES 3       // Number of timer queries that can be in flight before skipping measurements
+#endif
+
+// DPF: compact vertex layout (see ImDrawVert in imgui.h) has fixed point positions, scaled back by the projection matrix, and normalized texture coordinates
+#ifdef IMGUI_DPF_COMPACT_DRAWVERT
+#define IMGUI_IMPL_OPENGL_VTX_POS_TYPE      GL_SHORT
+#define IMGUI_IMPL_OPENGL_VTX_UV_TYPE       GL_SHORT
+#define IMGUI_IMPL_OPENGL_VTX_UV_NORMALIZED GL_TRUE
+#else
+#define IMGUI_IMPL_OPENGL_VTX_POS_TYPE      GL_FLOAT
+#define IMGUI_IMPL_OPENGL_VTX_UV_TYPE       GL_FLOAT
+#define IMGUI_IMPL_OPENGL_VTX_UV_NORMALIZED GL_FALSE
+#endif
+
 // [Debugging]
 //#define IMGUI_IMPL_OPENGL_DEBUG
 #ifdef IMGUI_IMPL_OPENGL_DEBUG
@@ -221,6 +271,17 @@
 #define GL_CALL(_CALL)      _CALL   // Call without error check
 #endif
 
+#ifdef IMGUI_DPF_BACKEND
+// DPF: texture created with ImGui_ImplOpenGL3_CreateUserTexture(), with a copy of its pixels and the rows changed since the last upload
+struct ImGui_ImplOpenGL3_UserTexture
+{
+    GLuint          Texture;
+    int             Width, Height;
+    unsigned char*  Pixels;
+    int             DirtyY0, DirtyY1;
+};
+#endif
+
 // OpenGL Data
 struct ImGui_ImplOpenGL3_Data
 {
@@ -243,6 +304,46 @@ struct ImGui_ImplOpenGL3_Data
     bool            HasPolygonMode;
     bool            HasClipOrigin;
     bool            UseBufferSubData;
+#ifdef IMGUI_DPF_BACKEND
+    GLuint          CacheFramebuffer;        // Offscreen framebuffer used to keep the last rendered frame around
+    GLuint          CacheTexture;
+    int             CacheWidth, CacheHeight;
+    bool            CacheValid;
+    bool            RenderingToCache;
+    bool            UseCacheDamageBox;       // Only render within CacheDamageBox, for partial updates of the cached frame
+    GLint           CacheDamageBox[4];
+    bool            CompositingCache;
+    ImDrawList*     CacheDrawList;           // Single textured quad used to composite the cached frame
+    int             FontTextureVersion;      // Font atlas version uploaded to FontTexture, for dynamic glyphs
+    int             TextureUploads;          // Number of texture uploads done so far, for profiling
+    ImVector<char>  UploadBuffer;            // Staging memory for merging all draw lists into a single upload
+    bool            StateCacheValid;         // Scissor box and texture last set for a draw command, to skip redundant state changes
+    GLint           ScissorBox[4];
+    GLuint          BoundTexture;
+    ImVector<ImGui_ImplOpenGL3_UserTexture> UserTextures;
+    GLuint          PixelBuffers[2];         // Pixel unpack buffers for user texture uploads, used alternately so that an upload does not wait for the previous one
+    int             PixelBufferIndex;
+#ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
+    GLuint          VaoHandle;               // Created once, DPF does not guarantee any vertex array object to be bound when rendering
+#endif
+#endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STREAMING
+    bool            UseStreamingBuffers;     // Stream vertex/index data through VboHandle/ElementsHandle used as ring buffers, instead of reallocating them for every draw list
+    GLsizeiptr      StreamVertexSegmentSize; // Ring buffers are split into segments, each RenderDrawData() call writes to the next one
+    GLsizeiptr      StreamIndexSegmentSize;
+    int             StreamSegment;
+    GLsync          StreamFences[IMGUI_IMPL_OPENGL_STREAM_SEGMENTS];
+#endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_PROGRAM_BINARY
+    bool            HasProgramBinary;        // Linked shader program can be retrieved and loaded back, see ImGui_ImplOpenGL3_ProgramBinaryCache
+#endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_TIMER_QUERY
+    bool            HasTimerQueries;
+    GLuint          TimerQueries[IMGUI_IMPL_OPENGL_TIMER_QUERIES];    // Ring of timer queries, TimerQueryCount of them waiting for results from TimerQueryFirst on
+    int             TimerQueryTags[IMGUI_IMPL_OPENGL_TIMER_QUERIES];
+    int             TimerQueryFirst, TimerQueryCount;
+    bool            TimerQueryActive;
+#endif
 
     ImGui_ImplOpenGL3_Data() { memset((void*)this, 0, sizeof(*this)); }
 };
@@ -394,8 +495,30 @@ bool    ImGui_ImplOpenGL3_Init(const char* glsl_version)
         const char* extension = (const char*)glGetStringi(GL_EXTENSIONS, i);
         if (extension != nullptr && strcmp(extension, "GL_ARB_clip_control") == 0)
             bd->HasClipOrigin = true;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_PROGRAM_BINARY
+        if (extension != nullptr && strcmp(extension, "GL_ARB_get_program_binary") == 0)
+            bd->HasProgramBinary = true;
+#endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_TIMER_QUERY
+        if (extension != nullptr && strcmp(extension, "GL_ARB_timer_query") == 0)
+            bd->HasTimerQueries = true;
+#endif
     }
 #endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_TIMER_QUERY
+    if (bd->GlVersion >= 330)
+        bd->HasTimerQueries = true;
+#endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STREAMING
+    bd->UseStreamingBuffers = (bd->GlVersion >= 320 || bd->GlProfileIsES3);
+#endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_PROGRAM_BINARY
+    // Drivers are allowed to support no binary formats at all (e.g. macOS)
+    GLint num_program_binary_formats = 0;
+    if (bd->GlVersion >= 410 || bd->GlProfileIsES3 || bd->HasProgramBinary)
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &num_program_binary_formats);
+    bd->HasProgramBinary = num_program_binary_formats > 0;
+#endif
 
     return true;
 }
@@ -407,6 +530,16 @@ void    ImGui_ImplOpenGL3_Shutdown()
     ImGuiIO& io = ImGui::GetIO();
 
     ImGui_ImplOpenGL3_DestroyDeviceObjects();
+#ifdef IMGUI_DPF_BACKEND
+    while (!bd->UserTextures.empty())
+        ImGui_ImplOpenGL3_DestroyUserTexture((ImTextureID)(intptr_t)bd->UserTextures.back().Texture);
+    for (GLuint& pixel_buffer : bd->PixelBuffers)
+        if (pixel_buffer != 0) { glDeleteBuffers(1, &pixel_buffer); pixel_buffer = 0; }
+#endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_TIMER_QUERY
+    if (bd->TimerQueries[0] != 0)
+        glDeleteQueries(IMGUI_IMPL_OPENGL_TIMER_QUERIES, bd->TimerQueries);
+#endif
     io.BackendRendererName = nullptr;
     io.BackendRendererUserData = nullptr;
     io.BackendFlags &= ~ImGuiBackendFlags_RendererHasVtxOffset;
@@ -424,20 +557,65 @@ void    ImGui_ImplOpenGL3_NewFrame()
         ImGui_ImplOpenGL3_CreateDeviceObjects();
     if (!bd->FontTexture)
         ImGui_ImplOpenGL3_CreateFontsTexture();
+#ifdef IMGUI_DPF_BACKEND
+    // The font atlas can be shared between several contexts, each with their own texture
+    else
+        ImGui::GetIO().Fonts->SetTexID((ImTextureID)(intptr_t)bd->FontTexture);
+#endif
 }
 
+#ifdef IMGUI_DPF_BACKEND
+// Setup the state DPF keeps in place while widgets draw, and which it expects to find again afterwards:
+// alpha-blending enabled, no face culling, no depth/stencil testing, polygon fill, texture unit 0 active, nothing bound.
+// RenderDrawData() only changes what imgui needs on top of this, so it is only set here after user callbacks asked for a reset.
+static void ImGui_ImplOpenGL3_SetupDefaultRenderState()
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    glEnable(GL_BLEND);
+    glBlendEquation(GL_FUNC_ADD);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glDisable(GL_CULL_FACE);
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_STENCIL_TEST);
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_PRIMITIVE_RESTART
+    if (bd->GlVersion >= 310)
+        glDisable(GL_PRIMITIVE_RESTART);
+#endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_POLYGON_MODE
+    if (bd->HasPolygonMode)
+        glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+#endif
+    glActiveTexture(GL_TEXTURE0);
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
+    if (bd->GlVersion >= 330 || bd->GlProfileIsES3)
+        glBindSampler(0, 0);
+#endif
+    (void)bd; // Not all compilation paths use this
+}
+#endif
+
 static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_width, int fb_height, GLuint vertex_array_object)
 {
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
 
     // Setup render state: alpha-blending enabled, no face culling, no depth testing, scissor enabled, polygon fill
+#ifndef IMGUI_DPF_BACKEND
     glEnable(GL_BLEND);
     glBlendEquation(GL_FUNC_ADD);
+#endif
     glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+#ifdef IMGUI_DPF_BACKEND
+    // Everything else is DPF default state already, see ImGui_ImplOpenGL3_SetupDefaultRenderState()
+    // The cached frame has premultiplied alpha
+    if (bd->CompositingCache)
+        glBlendFuncSeparate(GL_ONE, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+#else
     glDisable(GL_CULL_FACE);
     glDisable(GL_DEPTH_TEST);
     glDisable(GL_STENCIL_TEST);
+#endif
     glEnable(GL_SCISSOR_TEST);
+#ifndef IMGUI_DPF_BACKEND
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_PRIMITIVE_RESTART
     if (bd->GlVersion >= 310)
         glDisable(GL_PRIMITIVE_RESTART);
@@ -445,23 +623,29 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_POLYGON_MODE
     if (bd->HasPolygonMode)
         glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+#endif
 #endif
 
     // Support for GL 4.5 rarely used glClipControl(GL_UPPER_LEFT)
 #if defined(GL_CLIP_ORIGIN)
     bool clip_origin_lower_left = true;
+#ifndef IMGUI_DPF_BACKEND // DPF never changes the clip origin
     if (bd->HasClipOrigin)
     {
         GLenum current_clip_origin = 0; glGetIntegerv(GL_CLIP_ORIGIN, (GLint*)&current_clip_origin);
         if (current_clip_origin == GL_UPPER_LEFT)
             clip_origin_lower_left = false;
     }
+#endif
 #endif
 
     // Setup viewport, orthographic projection matrix
     // Our visible imgui space lies from draw_data->DisplayPos (top left) to draw_data->DisplayPos+data_data->DisplaySize (bottom right). DisplayPos is (0,0) for single viewport apps.
 #ifdef IMGUI_DPF_BACKEND
-    GL_CALL(glViewport(-draw_data->DisplayPos.x, draw_data->DisplayPos.y, (GLsizei)fb_width, (GLsizei)fb_height));
+    if (bd->RenderingToCache)
+        GL_CALL(glViewport(0, 0, (GLsizei)fb_width, (GLsizei)fb_height));
+    else
+        GL_CALL(glViewport(-draw_data->DisplayPos.x, draw_data->DisplayPos.y, (GLsizei)fb_width, (GLsizei)fb_height));
     float L = 0;
     float R = draw_data->DisplaySize.x;
     float T = 0;
@@ -475,6 +659,9 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
 #endif
 #if defined(GL_CLIP_ORIGIN)
     if (!clip_origin_lower_left) { float tmp = T; T = B; B = tmp; } // Swap top and bottom if origin is upper left
+#endif
+#ifdef IMGUI_DPF_COMPACT_DRAWVERT
+    L *= IMGUI_DPF_DRAWVERT_POS_SCALE; R *= IMGUI_DPF_DRAWVERT_POS_SCALE; T *= IMGUI_DPF_DRAWVERT_POS_SCALE; B *= IMGUI_DPF_DRAWVERT_POS_SCALE;
 #endif
     const float ortho_projection[4][4] =
     {
@@ -487,7 +674,7 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     glUniform1i(bd->AttribLocationTex, 0);
     glUniformMatrix4fv(bd->AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
 
-#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
+#if defined(IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER) && !defined(IMGUI_DPF_BACKEND)
     if (bd->GlVersion >= 330 || bd->GlProfileIsES3)
         glBindSampler(0, 0); // We use combined texture/sampler state. Applications using GL 3.3 and GL ES 3.0 may set that otherwise.
 #endif
@@ -503,11 +690,248 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxPos));
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxUV));
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxColor));
-    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, pos)));
-    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, uv)));
+    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxPos,   2, IMGUI_IMPL_OPENGL_VTX_POS_TYPE, GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, pos)));
+    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxUV,    2, IMGUI_IMPL_OPENGL_VTX_UV_TYPE,  IMGUI_IMPL_OPENGL_VTX_UV_NORMALIZED, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, uv)));
     GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, col)));
 }
 
+#ifdef IMGUI_DPF_BACKEND
+// Upload font texture rows with glyphs that were rasterized since the last upload (full rows, so that the source data is contiguous)
+static void ImGui_ImplOpenGL3_UpdateFontsTexture()
+{
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    int y, height;
+    if (bd->FontTexture == 0 || atlas->TexPixelsRGBA32 == nullptr || !ImFontAtlasGetTexUpdateRows(atlas, bd->FontTextureVersion, &y, &height))
+        return;
+
+    // Texture binding is not restored, RenderDrawData() resets it to DPF default state at the end
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, bd->FontTexture));
+#ifdef GL_UNPACK_ROW_LENGTH // Not on WebGL/ES
+    GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
+#endif
+    GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, y, atlas->TexWidth, height, GL_RGBA, GL_UNSIGNED_BYTE, atlas->TexPixelsRGBA32 + y * atlas->TexWidth));
+    bd->StateCacheValid = false;
+    bd->FontTextureVersion = ImFontAtlasGetTexVersion(atlas);
+    bd->TextureUploads++;
+}
+
+// Upload user texture rows changed since the last frame, all at once through a pixel unpack buffer when available.
+// Full rows are uploaded, so that the source data is contiguous without GL_UNPACK_ROW_LENGTH (not on ES2).
+static void ImGui_ImplOpenGL3_UpdateUserTextures()
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    GLsizeiptr upload_size = 0;
+    for (const ImGui_ImplOpenGL3_UserTexture& user_texture : bd->UserTextures)
+        if (user_texture.DirtyY0 < user_texture.DirtyY1)
+            upload_size += (GLsizeiptr)(user_texture.DirtyY1 - user_texture.DirtyY0) * user_texture.Width * 4;
+    if (upload_size == 0)
+        return;
+
+    bool use_pixel_buffer = false;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_BUFFER_PIXEL_UNPACK
+    if (bd->GlVersion >= 210)
+    {
+        // Orphan the buffer and copy all rows into it, texture uploads then read from it asynchronously
+        GLuint& pixel_buffer = bd->PixelBuffers[bd->PixelBufferIndex];
+        bd->PixelBufferIndex = (bd->PixelBufferIndex + 1) % IM_ARRAYSIZE(bd->PixelBuffers);
+        if (pixel_buffer == 0)
+            GL_CALL(glGenBuffers(1, &pixel_buffer));
+        GL_CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pixel_buffer));
+        GL_CALL(glBufferData(GL_PIXEL_UNPACK_BUFFER, upload_size, nullptr, GL_STREAM_DRAW));
+        GLsizeiptr offset = 0;
+        for (const ImGui_ImplOpenGL3_UserTexture& user_texture : bd->UserTextures)
+        {
+            if (user_texture.DirtyY0 >= user_texture.DirtyY1)
+                continue;
+            const GLsizeiptr size = (GLsizeiptr)(user_texture.DirtyY1 - user_texture.DirtyY0) * user_texture.Width * 4;
+            GL_CALL(glBufferSubData(GL_PIXEL_UNPACK_BUFFER, offset, size, user_texture.Pixels + user_texture.DirtyY0 * user_texture.Width * 4));
+            offset += size;
+        }
+        use_pixel_buffer = true;
+    }
+#endif
+
+    // Texture binding is not restored, RenderDrawData() resets it to DPF default state at the end
+#ifdef GL_UNPACK_ROW_LENGTH // Not on WebGL/ES
+    GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
+#endif
+    GLsizeiptr offset = 0;
+    for (ImGui_ImplOpenGL3_UserTexture& user_texture : bd->UserTextures)
+    {
+        if (user_texture.DirtyY0 >= user_texture.DirtyY1)
+            continue;
+        const int height = user_texture.DirtyY1 - user_texture.DirtyY0;
+        const void* pixels = use_pixel_buffer ? (const void*)(intptr_t)offset : (const void*)(user_texture.Pixels + user_texture.DirtyY0 * user_texture.Width * 4);
+        GL_CALL(glBindTexture(GL_TEXTURE_2D, user_texture.Texture));
+        GL_CALL(glTexSubImage2D(GL_TEXTURE_2D, 0, 0, user_texture.DirtyY0, user_texture.Width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels));
+        offset += (GLsizeiptr)height * user_texture.Width * 4;
+        user_texture.DirtyY0 = user_texture.DirtyY1 = 0;
+        bd->TextureUploads++;
+    }
+
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_BUFFER_PIXEL_UNPACK
+    if (use_pixel_buffer)
+        GL_CALL(glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0));
+#endif
+    bd->StateCacheValid = false;
+}
+
+// Intersect a scissor box with the damaged region of the cached frame, returns false if nothing is left to draw
+static bool ImGui_ImplOpenGL3_ClipToDamageBox(ImGui_ImplOpenGL3_Data* bd, GLint scissor_box[4])
+{
+    const GLint x0 = ImMax(scissor_box[0], bd->CacheDamageBox[0]);
+    const GLint y0 = ImMax(scissor_box[1], bd->CacheDamageBox[1]);
+    const GLint x1 = ImMin(scissor_box[0] + scissor_box[2], bd->CacheDamageBox[0] + bd->CacheDamageBox[2]);
+    const GLint y1 = ImMin(scissor_box[1] + scissor_box[3], bd->CacheDamageBox[1] + bd->CacheDamageBox[3]);
+    if (x1 <= x0 || y1 <= y0)
+        return false;
+    scissor_box[0] = x0;
+    scissor_box[1] = y0;
+    scissor_box[2] = x1 - x0;
+    scissor_box[3] = y1 - y0;
+    return true;
+}
+
+// Apply scissor rectangle and texture of a draw command, skipping whatever is the same as for the previous one
+static void ImGui_ImplOpenGL3_SetupDrawState(ImGui_ImplOpenGL3_Data* bd, const GLint scissor_box[4], GLuint texture)
+{
+    if (!bd->StateCacheValid || memcmp(bd->ScissorBox, scissor_box, sizeof(bd->ScissorBox)) != 0)
+    {
+        GL_CALL(glScissor(scissor_box[0], scissor_box[1], (GLsizei)scissor_box[2], (GLsizei)scissor_box[3]));
+        memcpy(bd->ScissorBox, scissor_box, sizeof(bd->ScissorBox));
+    }
+    if (!bd->StateCacheValid || bd->BoundTexture != texture)
+    {
+        GL_CALL(glBindTexture(GL_TEXTURE_2D, texture));
+        bd->BoundTexture = texture;
+    }
+    bd->StateCacheValid = true;
+}
+#endif
+
+#ifdef IMGUI_DPF_BACKEND
+// Point vertex attributes to a draw list stored at 'vtx_offset' bytes into the vertex buffer
+static void ImGui_ImplOpenGL3_SetupVertexAttribs(intptr_t vtx_offset)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxPos,   2, IMGUI_IMPL_OPENGL_VTX_POS_TYPE, GL_FALSE, sizeof(ImDrawVert), (GLvoid*)(vtx_offset + offsetof(ImDrawVert, pos))));
+    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxUV,    2, IMGUI_IMPL_OPENGL_VTX_UV_TYPE,  IMGUI_IMPL_OPENGL_VTX_UV_NORMALIZED, sizeof(ImDrawVert), (GLvoid*)(vtx_offset + offsetof(ImDrawVert, uv))));
+    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE, GL_TRUE,  sizeof(ImDrawVert), (GLvoid*)(vtx_offset + offsetof(ImDrawVert, col))));
+}
+
+// Upload the vertex/index data of all draw lists packed one after the other, with a single glBufferData() call per buffer (which must be bound)
+static void ImGui_ImplOpenGL3_UploadDrawData(ImDrawData* draw_data)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    if (draw_data->CmdListsCount == 1)
+    {
+        const ImDrawList* draw_list = draw_data->CmdLists[0];
+        GL_CALL(glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)draw_list->VtxBuffer.size_in_bytes(), (const GLvoid*)draw_list->VtxBuffer.Data, GL_STREAM_DRAW));
+        GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)draw_list->IdxBuffer.size_in_bytes(), (const GLvoid*)draw_list->IdxBuffer.Data, GL_STREAM_DRAW));
+        return;
+    }
+
+    ImVector<char>& staging = bd->UploadBuffer;
+    staging.resize(draw_data->TotalVtxCount * (int)sizeof(ImDrawVert));
+    char* dst = staging.Data;
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        memcpy(dst, draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.size_in_bytes());
+        dst += draw_list->VtxBuffer.size_in_bytes();
+    }
+    GL_CALL(glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)staging.Size, (const GLvoid*)staging.Data, GL_STREAM_DRAW));
+
+    staging.resize(draw_data->TotalIdxCount * (int)sizeof(ImDrawIdx));
+    dst = staging.Data;
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        memcpy(dst, draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.size_in_bytes());
+        dst += draw_list->IdxBuffer.size_in_bytes();
+    }
+    GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)staging.Size, (const GLvoid*)staging.Data, GL_STREAM_DRAW));
+}
+#endif
+
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STREAMING
+static void ImGui_ImplOpenGL3_DestroyStreamFences()
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    for (int i = 0; i < IMGUI_IMPL_OPENGL_STREAM_SEGMENTS; i++)
+        if (bd->StreamFences[i] != 0)
+        {
+            GL_CALL(glDeleteSync(bd->StreamFences[i]));
+            bd->StreamFences[i] = 0;
+        }
+}
+
+// Copy the vertex/index data of all draw lists into the next segment of the ring buffers (which must be bound), without any driver side reallocation.
+// The GPU is only waited on if it is still reading from that segment, IMGUI_IMPL_OPENGL_STREAM_SEGMENTS calls ago.
+// Returns the byte offsets of the segment, or false if mapping failed, in which case streaming is disabled.
+static bool ImGui_ImplOpenGL3_StreamDrawData(ImDrawData* draw_data, GLintptr* vtx_segment_offset, GLintptr* idx_segment_offset)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    const GLsizeiptr vtx_size = (GLsizeiptr)draw_data->TotalVtxCount * (int)sizeof(ImDrawVert);
+    const GLsizeiptr idx_size = (GLsizeiptr)draw_data->TotalIdxCount * (int)sizeof(ImDrawIdx);
+
+    // Grow both ring buffers when needed, which orphans the old storage (the GPU might still be using it) and makes all fences irrelevant
+    if (bd->StreamVertexSegmentSize < vtx_size || bd->StreamIndexSegmentSize < idx_size)
+    {
+        ImGui_ImplOpenGL3_DestroyStreamFences();
+        // Vertex segments are kept at a multiple of the vertex size, so that segment offsets work as base vertex
+        const GLsizeiptr vtx_count = (GLsizeiptr)draw_data->TotalVtxCount;
+        bd->StreamVertexSegmentSize = ImMax(bd->StreamVertexSegmentSize, ((vtx_count + vtx_count / 2 + 0xFFF) & ~(GLsizeiptr)0xFFF) * (int)sizeof(ImDrawVert));
+        bd->StreamIndexSegmentSize = ImMax(bd->StreamIndexSegmentSize, (idx_size + idx_size / 2 + 0xFFFF) & ~(GLsizeiptr)0xFFFF);
+        GL_CALL(glBufferData(GL_ARRAY_BUFFER, bd->StreamVertexSegmentSize * IMGUI_IMPL_OPENGL_STREAM_SEGMENTS, nullptr, GL_STREAM_DRAW));
+        GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, bd->StreamIndexSegmentSize * IMGUI_IMPL_OPENGL_STREAM_SEGMENTS, nullptr, GL_STREAM_DRAW));
+    }
+
+    const int segment = bd->StreamSegment;
+    if (GLsync fence = bd->StreamFences[segment])
+    {
+        GLenum result;
+        do
+            result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 100000000); // 100ms
+        while (result == GL_TIMEOUT_EXPIRED);
+        GL_CALL(glDeleteSync(fence));
+        bd->StreamFences[segment] = 0;
+    }
+
+    *vtx_segment_offset = bd->StreamVertexSegmentSize * segment;
+    *idx_segment_offset = bd->StreamIndexSegmentSize * segment;
+    if (vtx_size == 0 || idx_size == 0)
+        return true;
+
+    const GLbitfield access = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
+    char* vtx_dst = (char*)glMapBufferRange(GL_ARRAY_BUFFER, *vtx_segment_offset, vtx_size, access);
+    char* idx_dst = (char*)glMapBufferRange(GL_ELEMENT_ARRAY_BUFFER, *idx_segment_offset, idx_size, access);
+    if (vtx_dst != nullptr && idx_dst != nullptr)
+    {
+        for (const ImDrawList* draw_list : draw_data->CmdLists)
+        {
+            memcpy(vtx_dst, draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.size_in_bytes());
+            memcpy(idx_dst, draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.size_in_bytes());
+            vtx_dst += draw_list->VtxBuffer.size_in_bytes();
+            idx_dst += draw_list->IdxBuffer.size_in_bytes();
+        }
+    }
+
+    // Unmapping can fail if the contents got lost (e.g. video mode change), nothing we can do about that for a single frame
+    if (vtx_dst != nullptr)
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+    if (idx_dst != nullptr)
+        glUnmapBuffer(GL_ELEMENT_ARRAY_BUFFER);
+    if (vtx_dst != nullptr && idx_dst != nullptr)
+        return true;
+
+    // Mapping is not working for some reason, go back to merged uploads
+    ImGui_ImplOpenGL3_DestroyStreamFences();
+    bd->UseStreamingBuffers = false;
+    bd->StreamVertexSegmentSize = bd->StreamIndexSegmentSize = 0;
+    return false;
+}
+#endif
+
 // OpenGL3 Render function.
 // Note that this implementation is little overcomplicated because we are saving/setting up/restoring every OpenGL state explicitly.
 // This is in order to be able to run within an OpenGL engine that doesn't do so.
@@ -523,6 +947,22 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
 
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
 
+#ifdef IMGUI_DPF_BACKEND
+    // DPF owns the GL context and calls us with its default state in place (see ImGui_ImplOpenGL3_SetupDefaultRenderState()),
+    // so instead of querying and restoring all GL state, only what imgui needs on top of it is set here and reverted at the end.
+    // Vertex attributes are set on our own vertex array object, as core profiles cannot draw without one and the one bound
+    // by DPF (if any) must not be modified. Viewport is changed when rendering into the cache framebuffer.
+    bd->StateCacheValid = false;
+    ImGui_ImplOpenGL3_UpdateFontsTexture();
+    ImGui_ImplOpenGL3_UpdateUserTextures();
+    GLint last_viewport[4]; glGetIntegerv(GL_VIEWPORT, last_viewport);
+#ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
+    GLuint last_vertex_array_object; glGetIntegerv(GL_VERTEX_ARRAY_BINDING, (GLint*)&last_vertex_array_object);
+    GLuint vertex_array_object = bd->VaoHandle;
+#else
+    GLuint vertex_array_object = 0;
+#endif
+#else
     // Backup GL state
     GLenum last_active_texture; glGetIntegerv(GL_ACTIVE_TEXTURE, (GLint*)&last_active_texture);
     glActiveTexture(GL_TEXTURE0);
@@ -568,18 +1008,49 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     GLuint vertex_array_object = 0;
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
     GL_CALL(glGenVertexArrays(1, &vertex_array_object));
+#endif
 #endif
     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
 
     // Will project scissor/clipping rectangles into framebuffer space
     ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
+#ifdef IMGUI_DPF_BACKEND
+    if (bd->RenderingToCache)
+        clip_off = ImVec2(0.0f, 0.0f);
+#endif
     ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
 
+#ifdef IMGUI_DPF_BACKEND
+    // Upload all draw lists at once, streamed into the next ring buffer segment or as a single merged upload.
+    // Draws point into that data with base vertex where available, instead of changing vertex attributes for every draw list.
+    GLintptr vtx_buffer_offset = 0; // Byte offsets of the current draw list
+    GLintptr idx_buffer_offset = 0;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STREAMING
+    const bool use_streaming = bd->UseStreamingBuffers && ImGui_ImplOpenGL3_StreamDrawData(draw_data, &vtx_buffer_offset, &idx_buffer_offset);
+    if (!use_streaming)
+#endif
+        ImGui_ImplOpenGL3_UploadDrawData(draw_data);
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
+    const bool use_base_vertex = (bd->GlVersion >= 320);
+#else
+    const bool use_base_vertex = false;
+#endif
+#endif
+
     // Render command lists
     for (int n = 0; n < draw_data->CmdListsCount; n++)
     {
         const ImDrawList* draw_list = draw_data->CmdLists[n];
 
+#ifdef IMGUI_DPF_BACKEND
+        if (n != 0)
+        {
+            vtx_buffer_offset += draw_data->CmdLists[n - 1]->VtxBuffer.size_in_bytes();
+            idx_buffer_offset += draw_data->CmdLists[n - 1]->IdxBuffer.size_in_bytes();
+        }
+        if (!use_base_vertex)
+            ImGui_ImplOpenGL3_SetupVertexAttribs(vtx_buffer_offset);
+#else
         // Upload vertex/index buffers
         // - OpenGL drivers are in a very sorry state nowadays....
         //   During 2021 we attempted to switch from glBufferData() to orphaning+glBufferSubData() following reports
@@ -610,6 +1081,7 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
             GL_CALL(glBufferData(GL_ARRAY_BUFFER, vtx_buffer_size, (const GLvoid*)draw_list->VtxBuffer.Data, GL_STREAM_DRAW));
             GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, idx_buffer_size, (const GLvoid*)draw_list->IdxBuffer.Data, GL_STREAM_DRAW));
         }
+#endif
 
         for (int cmd_i = 0; cmd_i < draw_list->CmdBuffer.Size; cmd_i++)
         {
@@ -619,9 +1091,21 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 // User callback, registered via ImDrawList::AddCallback()
                 // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
                 if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
+                {
+#ifdef IMGUI_DPF_BACKEND
+                    ImGui_ImplOpenGL3_SetupDefaultRenderState();
+#endif
                     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
+#ifdef IMGUI_DPF_BACKEND
+                    if (!use_base_vertex)
+                        ImGui_ImplOpenGL3_SetupVertexAttribs(vtx_buffer_offset);
+#endif
+                }
                 else
                     pcmd->UserCallback(draw_list, pcmd);
+#ifdef IMGUI_DPF_BACKEND
+                bd->StateCacheValid = false;
+#endif
             }
             else
             {
@@ -631,6 +1115,20 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
                     continue;
 
+#ifdef IMGUI_DPF_BACKEND
+                // Apply scissor/clipping rectangle (Y is inverted in OpenGL) and bind texture, if changed, Draw
+                GLint scissor_box[4] = { (int)clip_min.x, (int)((float)fb_height - clip_max.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y) };
+                if (bd->UseCacheDamageBox && !ImGui_ImplOpenGL3_ClipToDamageBox(bd, scissor_box))
+                    continue;
+                ImGui_ImplOpenGL3_SetupDrawState(bd, scissor_box, (GLuint)(intptr_t)pcmd->GetTexID());
+                void* idx_offset = (void*)(idx_buffer_offset + pcmd->IdxOffset * sizeof(ImDrawIdx));
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
+                if (use_base_vertex)
+                    GL_CALL(glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, idx_offset, (GLint)(pcmd->VtxOffset + vtx_buffer_offset / (GLintptr)sizeof(ImDrawVert))));
+                else
+#endif
+                GL_CALL(glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, idx_offset));
+#else
                 // Apply scissor/clipping rectangle (Y is inverted in OpenGL)
                 GL_CALL(glScissor((int)clip_min.x, (int)((float)fb_height - clip_max.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y)));
 
@@ -642,10 +1140,39 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
                 else
 #endif
                 GL_CALL(glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx))));
+#endif
             }
         }
     }
 
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STREAMING
+    // Segment can be written to again once the GPU is done with these draws
+    if (use_streaming)
+    {
+        bd->StreamFences[bd->StreamSegment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        bd->StreamSegment = (bd->StreamSegment + 1) % IMGUI_IMPL_OPENGL_STREAM_SEGMENTS;
+    }
+#endif
+
+#ifdef IMGUI_DPF_BACKEND
+    // Back to DPF default state
+    glUseProgram(0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+#ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
+    // Element buffer and vertex attributes are part of our vertex array object
+    glBindVertexArray(last_vertex_array_object);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+#else
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+    glDisableVertexAttribArray(bd->AttribLocationVtxPos);
+    glDisableVertexAttribArray(bd->AttribLocationVtxUV);
+    glDisableVertexAttribArray(bd->AttribLocationVtxColor);
+#endif
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glDisable(GL_SCISSOR_TEST);
+    glViewport(last_viewport[0], last_viewport[1], (GLsizei)last_viewport[2], (GLsizei)last_viewport[3]);
+#else
     // Destroy the temporary VAO
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
     GL_CALL(glDeleteVertexArrays(1, &vertex_array_object));
@@ -688,9 +1215,165 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
 
     glViewport(last_viewport[0], last_viewport[1], (GLsizei)last_viewport[2], (GLsizei)last_viewport[3]);
     glScissor(last_scissor_box[0], last_scissor_box[1], (GLsizei)last_scissor_box[2], (GLsizei)last_scissor_box[3]);
+#endif
     (void)bd; // Not all compilation paths use this
 }
 
+#ifdef IMGUI_DPF_BACKEND
+// (Re)create the offscreen framebuffer used for caching frames, if needed
+static bool ImGui_ImplOpenGL3_UpdateCache(int fb_width, int fb_height)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    if (bd->CacheFramebuffer != 0 && bd->CacheWidth == fb_width && bd->CacheHeight == fb_height)
+        return true;
+
+    if (bd->CacheTexture == 0)
+        GL_CALL(glGenTextures(1, &bd->CacheTexture));
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, bd->CacheTexture));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
+    GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, fb_width, fb_height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr));
+
+    if (bd->CacheFramebuffer == 0)
+        GL_CALL(glGenFramebuffers(1, &bd->CacheFramebuffer));
+    GL_CALL(glBindFramebuffer(GL_FRAMEBUFFER, bd->CacheFramebuffer));
+    GL_CALL(glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, bd->CacheTexture, 0));
+    const bool complete = glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+
+    // DPF draws into the default framebuffer, and keeps no texture bound
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    bd->CacheValid = false;
+
+    if (!complete)
+    {
+        ImGui_ImplOpenGL3_DestroyCache();
+        return false;
+    }
+
+    bd->CacheWidth = fb_width;
+    bd->CacheHeight = fb_height;
+    return true;
+}
+
+void ImGui_ImplOpenGL3_RenderDrawDataToCache(ImDrawData* draw_data, const ImVec4* damage_rect)
+{
+    int fb_width = (int)(draw_data->DisplaySize.x * draw_data->FramebufferScale.x);
+    int fb_height = (int)(draw_data->DisplaySize.y * draw_data->FramebufferScale.y);
+    if (fb_width <= 0 || fb_height <= 0)
+        return;
+
+    // Fallback to regular rendering if offscreen framebuffers are not usable
+    if (!ImGui_ImplOpenGL3_UpdateCache(fb_width, fb_height))
+    {
+        ImGui_ImplOpenGL3_RenderDrawData(draw_data);
+        return;
+    }
+
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+
+    // Only the damaged region needs to be rendered again while the previous frame is still in the cache
+    bd->UseCacheDamageBox = damage_rect != nullptr && bd->CacheValid;
+    if (bd->UseCacheDamageBox)
+    {
+        const ImVec2 scale = draw_data->FramebufferScale;
+        const int x0 = ImClamp((int)ImFloor(damage_rect->x * scale.x), 0, fb_width);
+        const int y0 = ImClamp((int)ImFloor(damage_rect->y * scale.y), 0, fb_height);
+        const int x1 = ImClamp((int)ImCeil(damage_rect->z * scale.x), x0, fb_width);
+        const int y1 = ImClamp((int)ImCeil(damage_rect->w * scale.y), y0, fb_height);
+        bd->CacheDamageBox[0] = x0;
+        bd->CacheDamageBox[1] = fb_height - y1;
+        bd->CacheDamageBox[2] = x1 - x0;
+        bd->CacheDamageBox[3] = y1 - y0;
+    }
+
+    // DPF sets its own clear color before clearing, and scissor test is left disabled by RenderDrawData() anyway when clearing everything.
+    // The viewport is set up again by ImGui_ImplOpenGL3_SetupRenderState() when compositing.
+    GL_CALL(glBindFramebuffer(GL_FRAMEBUFFER, bd->CacheFramebuffer));
+    if (bd->UseCacheDamageBox)
+    {
+        glEnable(GL_SCISSOR_TEST);
+        glScissor(bd->CacheDamageBox[0], bd->CacheDamageBox[1], bd->CacheDamageBox[2], bd->CacheDamageBox[3]);
+    }
+    else
+    {
+        glDisable(GL_SCISSOR_TEST);
+    }
+    glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    bd->RenderingToCache = true;
+    ImGui_ImplOpenGL3_RenderDrawData(draw_data);
+    bd->RenderingToCache = false;
+    bd->UseCacheDamageBox = false;
+    bd->CacheValid = true;
+
+    GL_CALL(glBindFramebuffer(GL_FRAMEBUFFER, 0));
+    ImGui_ImplOpenGL3_RenderCachedDrawData(draw_data);
+}
+
+bool ImGui_ImplOpenGL3_RenderCachedDrawData(ImDrawData* draw_data)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    int fb_width = (int)(draw_data->DisplaySize.x * draw_data->FramebufferScale.x);
+    int fb_height = (int)(draw_data->DisplaySize.y * draw_data->FramebufferScale.y);
+    if (!bd->CacheValid || bd->CacheWidth != fb_width || bd->CacheHeight != fb_height)
+        return false;
+
+    if (bd->CacheDrawList == nullptr)
+        bd->CacheDrawList = IM_NEW(ImDrawList)(nullptr);
+
+    // Single quad covering the whole display, framebuffer contents are upside-down compared to ImGui coordinates
+    const float w = draw_data->DisplaySize.x;
+    const float h = draw_data->DisplaySize.y;
+    ImDrawList* draw_list = bd->CacheDrawList;
+    draw_list->VtxBuffer.resize(4);
+    draw_list->IdxBuffer.resize(6);
+    draw_list->CmdBuffer.resize(1);
+    ImDrawVert* vtx = draw_list->VtxBuffer.Data;
+    vtx[0].pos = ImVec2(0.0f, 0.0f); vtx[0].uv = ImVec2(0.0f, 1.0f); vtx[0].col = IM_COL32_WHITE;
+    vtx[1].pos = ImVec2(w, 0.0f);    vtx[1].uv = ImVec2(1.0f, 1.0f); vtx[1].col = IM_COL32_WHITE;
+    vtx[2].pos = ImVec2(w, h);       vtx[2].uv = ImVec2(1.0f, 0.0f); vtx[2].col = IM_COL32_WHITE;
+    vtx[3].pos = ImVec2(0.0f, h);    vtx[3].uv = ImVec2(0.0f, 0.0f); vtx[3].col = IM_COL32_WHITE;
+    ImDrawIdx* idx = draw_list->IdxBuffer.Data;
+    idx[0] = 0; idx[1] = 1; idx[2] = 2;
+    idx[3] = 0; idx[4] = 2; idx[5] = 3;
+    ImDrawCmd cmd;
+    cmd.ClipRect = ImVec4(0.0f, 0.0f, w, h);
+    cmd.TextureId = (ImTextureID)(intptr_t)bd->CacheTexture;
+    cmd.ElemCount = 6;
+    draw_list->CmdBuffer[0] = cmd;
+
+    ImDrawData cache_draw_data;
+    cache_draw_data.Valid = true;
+    cache_draw_data.CmdLists.push_back(draw_list);
+    cache_draw_data.CmdListsCount = 1;
+    cache_draw_data.TotalVtxCount = 4;
+    cache_draw_data.TotalIdxCount = 6;
+    cache_draw_data.DisplayPos = draw_data->DisplayPos;
+    cache_draw_data.DisplaySize = draw_data->DisplaySize;
+    cache_draw_data.FramebufferScale = draw_data->FramebufferScale;
+
+    bd->CompositingCache = true;
+    ImGui_ImplOpenGL3_RenderDrawData(&cache_draw_data);
+    bd->CompositingCache = false;
+    return true;
+}
+
+void ImGui_ImplOpenGL3_DestroyCache()
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    if (bd->CacheFramebuffer) { glDeleteFramebuffers(1, &bd->CacheFramebuffer); bd->CacheFramebuffer = 0; }
+    if (bd->CacheTexture)     { glDeleteTextures(1, &bd->CacheTexture); bd->CacheTexture = 0; }
+    if (bd->CacheDrawList)    { IM_DELETE(bd->CacheDrawList); bd->CacheDrawList = nullptr; }
+    bd->CacheWidth = bd->CacheHeight = 0;
+    bd->CacheValid = false;
+}
+#endif
+
 bool ImGui_ImplOpenGL3_CreateFontsTexture()
 {
     ImGuiIO& io = ImGui::GetIO();
@@ -718,6 +1401,10 @@ bool ImGui_ImplOpenGL3_CreateFontsTexture()
 
     // Store identifier
     io.Fonts->SetTexID((ImTextureID)(intptr_t)bd->FontTexture);
+#ifdef IMGUI_DPF_BACKEND
+    bd->FontTextureVersion = ImFontAtlasGetTexVersion(io.Fonts);
+    bd->TextureUploads++;
+#endif
 
     // Restore state
     GL_CALL(glBindTexture(GL_TEXTURE_2D, last_texture));
@@ -737,6 +1424,377 @@ void ImGui_ImplOpenGL3_DestroyFontsTexture()
     }
 }
 
+#ifdef IMGUI_DPF_BACKEND
+ImTextureID ImGui_ImplOpenGL3_ReleaseFontsTexture()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    const ImTextureID texture = (ImTextureID)(intptr_t)bd->FontTexture;
+    io.Fonts->SetTexID(0);
+    bd->FontTexture = 0;
+    return texture;
+}
+
+void ImGui_ImplOpenGL3_SetFontsTexture(ImTextureID texture)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    ImGui_ImplOpenGL3_DestroyFontsTexture();
+    bd->FontTexture = (GLuint)(intptr_t)texture;
+    bd->FontTextureVersion = 0; // Not known, upload all dynamic glyphs again
+    io.Fonts->SetTexID(texture);
+}
+
+void ImGui_ImplOpenGL3_DestroyTexture(ImTextureID texture)
+{
+    GLuint gl_texture = (GLuint)(intptr_t)texture;
+    GL_CALL(glDeleteTextures(1, &gl_texture));
+}
+
+static ImGui_ImplOpenGL3_UserTexture* ImGui_ImplOpenGL3_FindUserTexture(ImGui_ImplOpenGL3_Data* bd, ImTextureID texture)
+{
+    for (ImGui_ImplOpenGL3_UserTexture& user_texture : bd->UserTextures)
+        if (user_texture.Texture == (GLuint)(intptr_t)texture)
+            return &user_texture;
+    return nullptr;
+}
+
+ImTextureID ImGui_ImplOpenGL3_CreateUserTexture(int width, int height)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    IM_ASSERT(width > 0 && height > 0);
+
+    ImGui_ImplOpenGL3_UserTexture user_texture;
+    user_texture.Width = width;
+    user_texture.Height = height;
+    user_texture.Pixels = (unsigned char*)IM_ALLOC((size_t)width * height * 4);
+    user_texture.DirtyY0 = user_texture.DirtyY1 = 0;
+    memset(user_texture.Pixels, 0, (size_t)width * height * 4);
+
+    // Texture binding is not restored, RenderDrawData() sets what it needs
+    GL_CALL(glGenTextures(1, &user_texture.Texture));
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, user_texture.Texture));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
+#ifdef GL_UNPACK_ROW_LENGTH // Not on WebGL/ES
+    GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
+#endif
+    GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, user_texture.Pixels));
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, 0));
+    bd->StateCacheValid = false;
+
+    bd->UserTextures.push_back(user_texture);
+    return (ImTextureID)(intptr_t)user_texture.Texture;
+}
+
+void ImGui_ImplOpenGL3_UpdateUserTexture(ImTextureID texture, int x, int y, int width, int height, const void* pixels, int pitch)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    ImGui_ImplOpenGL3_UserTexture* user_texture = ImGui_ImplOpenGL3_FindUserTexture(bd, texture);
+    IM_ASSERT(user_texture != nullptr && "Texture was not created with ImGui_ImplOpenGL3_CreateUserTexture()");
+    IM_ASSERT(x >= 0 && y >= 0 && width > 0 && height > 0 && x + width <= user_texture->Width && y + height <= user_texture->Height);
+    if (user_texture == nullptr || x < 0 || y < 0 || width <= 0 || height <= 0 || x + width > user_texture->Width || y + height > user_texture->Height)
+        return;
+
+    if (pitch == 0)
+        pitch = width * 4;
+    for (int row = 0; row < height; ++row)
+        memcpy(user_texture->Pixels + ((y + row) * user_texture->Width + x) * 4, (const unsigned char*)pixels + row * pitch, (size_t)width * 4);
+
+    if (user_texture->DirtyY0 < user_texture->DirtyY1)
+    {
+        user_texture->DirtyY0 = ImMin(user_texture->DirtyY0, y);
+        user_texture->DirtyY1 = ImMax(user_texture->DirtyY1, y + height);
+    }
+    else
+    {
+        user_texture->DirtyY0 = y;
+        user_texture->DirtyY1 = y + height;
+    }
+}
+
+void ImGui_ImplOpenGL3_DestroyUserTexture(ImTextureID texture)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    ImGui_ImplOpenGL3_UserTexture* user_texture = ImGui_ImplOpenGL3_FindUserTexture(bd, texture);
+    IM_ASSERT(user_texture != nullptr && "Texture was not created with ImGui_ImplOpenGL3_CreateUserTexture()");
+    if (user_texture == nullptr)
+        return;
+
+    GL_CALL(glDeleteTextures(1, &user_texture->Texture));
+    IM_FREE(user_texture->Pixels);
+    bd->UserTextures.erase(user_texture);
+    bd->StateCacheValid = false;
+}
+
+int ImGui_ImplOpenGL3_GetTextureUploadCount()
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    return bd != nullptr ? bd->TextureUploads : 0;
+}
+
+bool ImGui_ImplOpenGL3_BeginGpuTimer(int tag)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_TIMER_QUERY
+    IM_ASSERT(bd != nullptr && !bd->TimerQueryActive);
+
+    // Skip measuring rather than waiting when the GPU is that far behind
+    if (!bd->HasTimerQueries || bd->TimerQueryCount == IMGUI_IMPL_OPENGL_TIMER_QUERIES)
+        return false;
+
+    if (bd->TimerQueries[0] == 0)
+        glGenQueries(IMGUI_IMPL_OPENGL_TIMER_QUERIES, bd->TimerQueries);
+
+    const int index = (bd->TimerQueryFirst + bd->TimerQueryCount) % IMGUI_IMPL_OPENGL_TIMER_QUERIES;
+    bd->TimerQueryTags[index] = tag;
+    bd->TimerQueryActive = true;
+    glBeginQuery(GL_TIME_ELAPSED, bd->TimerQueries[index]);
+    return true;
+#else
+    IM_UNUSED(bd);
+    IM_UNUSED(tag);
+    return false;
+#endif
+}
+
+void ImGui_ImplOpenGL3_EndGpuTimer()
+{
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_TIMER_QUERY
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    IM_ASSERT(bd != nullptr && bd->TimerQueryActive);
+
+    glEndQuery(GL_TIME_ELAPSED);
+    bd->TimerQueryActive = false;
+    ++bd->TimerQueryCount;
+#endif
+}
+
+bool ImGui_ImplOpenGL3_GetGpuTimerResult(int* tag, double* milliseconds)
+{
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_TIMER_QUERY
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    if (bd == nullptr || bd->TimerQueryCount == 0)
+        return false;
+
+    const GLuint query = bd->TimerQueries[bd->TimerQueryFirst];
+    GLint available = 0;
+    glGetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available)
+        return false;
+
+    GLuint64 nanoseconds = 0;
+    glGetQueryObjectui64v(query, GL_QUERY_RESULT, &nanoseconds);
+    *tag = bd->TimerQueryTags[bd->TimerQueryFirst];
+    *milliseconds = (double)nanoseconds / 1000000.0;
+    bd->TimerQueryFirst = (bd->TimerQueryFirst + 1) % IMGUI_IMPL_OPENGL_TIMER_QUERIES;
+    --bd->TimerQueryCount;
+    return true;
+#else
+    IM_UNUSED(tag);
+    IM_UNUSED(milliseconds);
+    return false;
+#endif
+}
+#endif
+
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_PROGRAM_BINARY
+// Linked shader program shared by all contexts of the process, and optionally kept on disk between sessions.
+// Program binaries are only valid for the driver that produced them, so they are keyed by GL renderer and version strings (plus our GLSL version),
+// and a hash of the shader sources so that a binary linked from different sources (e.g. older builds sharing the directory) is never used.
+struct ImGui_ImplOpenGL3_ProgramBinaryCache
+{
+    char    Key[512];
+    GLenum  Format;
+    GLsizei Size;
+    void*   Data;
+    char*   Directory;
+
+    ImGui_ImplOpenGL3_ProgramBinaryCache() { memset((void*)this, 0, sizeof(*this)); }
+    ~ImGui_ImplOpenGL3_ProgramBinaryCache() { free(Data); free(Directory); }
+
+    void Set(const char* key, GLenum format, GLsizei size, void* data)
+    {
+        free(Data);
+        ImStrncpy(Key, key, sizeof(Key));
+        Format = format;
+        Size = size;
+        Data = data;
+    }
+};
+static ImGui_ImplOpenGL3_ProgramBinaryCache g_ImplOpenGL3_ProgramBinaryCache;
+
+static void ImGui_ImplOpenGL3_GetProgramBinaryKey(char* key, size_t key_size, const GLchar* vertex_shader, const GLchar* fragment_shader)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    const char* renderer = (const char*)glGetString(GL_RENDERER);
+    const char* version = (const char*)glGetString(GL_VERSION);
+    const ImGuiID prefix_hash = ImHashData(bd->GlslVersionString, strlen(bd->GlslVersionString));
+    const ImGuiID vertex_hash = ImHashData(vertex_shader, strlen(vertex_shader), prefix_hash);
+    const ImGuiID fragment_hash = ImHashData(fragment_shader, strlen(fragment_shader), prefix_hash);
+    snprintf(key, key_size, "%s\n%s\n%s\n%08x%08x", renderer ? renderer : "", version ? version : "", bd->GlslVersionString, (unsigned int)vertex_hash, (unsigned int)fragment_hash);
+}
+
+// On-disk file layout: key (null terminated), binary format (uint32), binary data
+static void ImGui_ImplOpenGL3_GetProgramBinaryFilename(const char* key, char* filename, size_t filename_size)
+{
+    snprintf(filename, filename_size, "%s/imgui-opengl3-%08x.bin", g_ImplOpenGL3_ProgramBinaryCache.Directory, (unsigned int)ImHashStr(key));
+}
+
+static void ImGui_ImplOpenGL3_ReadProgramBinaryFile(const char* key)
+{
+    ImGui_ImplOpenGL3_ProgramBinaryCache& cache = g_ImplOpenGL3_ProgramBinaryCache;
+    if (cache.Directory == nullptr)
+        return;
+
+    char filename[1024];
+    ImGui_ImplOpenGL3_GetProgramBinaryFilename(key, filename, sizeof(filename));
+    size_t file_size = 0;
+    char* file_data = (char*)ImFileLoadToMemory(filename, "rb", &file_size);
+    if (file_data == nullptr)
+        return;
+
+    const size_t key_size = strlen(key) + 1;
+    if (file_size > key_size + sizeof(ImU32) && memcmp(file_data, key, key_size) == 0)
+    {
+        ImU32 format;
+        memcpy(&format, file_data + key_size, sizeof(format));
+        const size_t size = file_size - key_size - sizeof(format);
+        if (void* data = malloc(size))
+        {
+            memcpy(data, file_data + key_size + sizeof(format), size);
+            cache.Set(key, (GLenum)format, (GLsizei)size, data);
+        }
+    }
+    IM_FREE(file_data);
+}
+
+// Move a written temporary file to its final name, replacing any existing file, or delete it if writing failed
+static void ImGui_ImplOpenGL3_MoveProgramBinaryFile(const char* tmp_filename, const char* filename, bool ok)
+{
+#ifdef IMGUI_IMPL_OPENGL_USE_WIN32_MOVE_FILE
+    // Paths are UTF-8, same as for ImFileOpen()
+    wchar_t tmp_filename_w[1024 + 16], filename_w[1024];
+    if (::MultiByteToWideChar(CP_UTF8, 0, tmp_filename, -1, tmp_filename_w, IM_ARRAYSIZE(tmp_filename_w)) == 0)
+        return;
+    if (!ok || ::MultiByteToWideChar(CP_UTF8, 0, filename, -1, filename_w, IM_ARRAYSIZE(filename_w)) == 0 || !::MoveFileExW(tmp_filename_w, filename_w, MOVEFILE_REPLACE_EXISTING))
+        ::DeleteFileW(tmp_filename_w);
+#else
+#ifdef _WIN32
+    if (ok)
+        remove(filename);
+#endif
+    if (!ok || rename(tmp_filename, filename) != 0)
+        remove(tmp_filename);
+#endif
+}
+
+static void ImGui_ImplOpenGL3_WriteProgramBinaryFile()
+{
+    ImGui_ImplOpenGL3_ProgramBinaryCache& cache = g_ImplOpenGL3_ProgramBinaryCache;
+    if (cache.Directory == nullptr)
+        return;
+
+    // Written under a temporary name first, so that other processes never read a partial file.
+    // The temporary name is unique per process, as several hosts may create the same program at once.
+    char filename[1024], tmp_filename[1024 + 16];
+    ImGui_ImplOpenGL3_GetProgramBinaryFilename(cache.Key, filename, sizeof(filename));
+#ifdef _WIN32
+    const unsigned int pid = (unsigned int)_getpid();
+#else
+    const unsigned int pid = (unsigned int)getpid();
+#endif
+    snprintf(tmp_filename, sizeof(tmp_filename), "%s.%u.tmp", filename, pid);
+    ImFileHandle f = ImFileOpen(tmp_filename, "wb");
+    if (f == nullptr)
+        return;
+
+    const ImU32 format = (ImU32)cache.Format;
+    const bool ok = ImFileWrite(cache.Key, 1, strlen(cache.Key) + 1, f) == strlen(cache.Key) + 1
+                 && ImFileWrite(&format, sizeof(format), 1, f) == 1
+                 && ImFileWrite(cache.Data, 1, (ImU64)cache.Size, f) == (ImU64)cache.Size;
+    ImFileClose(f);
+    ImGui_ImplOpenGL3_MoveProgramBinaryFile(tmp_filename, filename, ok);
+}
+
+// Create bd->ShaderHandle from a previously linked program of the same shaders, if any
+static bool ImGui_ImplOpenGL3_LoadProgramBinary(const GLchar* vertex_shader, const GLchar* fragment_shader)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    ImGui_ImplOpenGL3_ProgramBinaryCache& cache = g_ImplOpenGL3_ProgramBinaryCache;
+    if (!bd->HasProgramBinary)
+        return false;
+
+    char key[sizeof(cache.Key)];
+    ImGui_ImplOpenGL3_GetProgramBinaryKey(key, sizeof(key), vertex_shader, fragment_shader);
+    if (cache.Data == nullptr || strcmp(cache.Key, key) != 0)
+        ImGui_ImplOpenGL3_ReadProgramBinaryFile(key);
+    if (cache.Data == nullptr || strcmp(cache.Key, key) != 0)
+        return false;
+
+    GLuint program = glCreateProgram();
+    glProgramBinary(program, cache.Format, cache.Data, cache.Size);
+    GLint status = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &status);
+    if (status == GL_FALSE)
+    {
+        // Rejected by the driver (e.g. after an update with the same version string), compile again and replace it
+        glDeleteProgram(program);
+        cache.Set("", 0, 0, nullptr);
+        return false;
+    }
+    bd->ShaderHandle = program;
+    return true;
+}
+
+// Keep the freshly linked bd->ShaderHandle around for next time
+static void ImGui_ImplOpenGL3_SaveProgramBinary(const GLchar* vertex_shader, const GLchar* fragment_shader)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    if (!bd->HasProgramBinary)
+        return;
+
+    GLint size = 0;
+    glGetProgramiv(bd->ShaderHandle, GL_PROGRAM_BINARY_LENGTH, &size);
+    void* data = size > 0 ? malloc((size_t)size) : nullptr;
+    if (data == nullptr)
+        return;
+
+    GLenum format = 0;
+    GLsizei length = 0;
+    glGetProgramBinary(bd->ShaderHandle, size, &length, &format, data);
+    if (length <= 0)
+    {
+        free(data);
+        return;
+    }
+
+    char key[sizeof(g_ImplOpenGL3_ProgramBinaryCache.Key)];
+    ImGui_ImplOpenGL3_GetProgramBinaryKey(key, sizeof(key), vertex_shader, fragment_shader);
+    g_ImplOpenGL3_ProgramBinaryCache.Set(key, format, length, data);
+    ImGui_ImplOpenGL3_WriteProgramBinaryFile();
+}
+#endif
+
+#ifdef IMGUI_DPF_BACKEND
+void ImGui_ImplOpenGL3_SetProgramBinaryCacheDirectory(const char* path)
+{
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_PROGRAM_BINARY
+    ImGui_ImplOpenGL3_ProgramBinaryCache& cache = g_ImplOpenGL3_ProgramBinaryCache;
+    free(cache.Directory);
+    cache.Directory = nullptr;
+    if (path != nullptr && path[0] != '\0')
+    {
+        const size_t path_size = strlen(path) + 1;
+        if ((cache.Directory = (char*)malloc(path_size)) != nullptr)
+            memcpy(cache.Directory, path, path_size);
+    }
+#else
+    (void)path;
+#endif
+}
+#endif
+
 // If you get an error please report on github. You may try different GL context version or GLSL version. See GL<>GLSL version table at the top of this file.
 static bool CheckShader(GLuint handle, const char* desc)
 {
@@ -921,6 +1979,11 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
     }
 
     // Create shaders
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_PROGRAM_BINARY
+    // DPF: reuse the program linked by a previous context or session if possible
+    if (!ImGui_ImplOpenGL3_LoadProgramBinary(vertex_shader, fragment_shader))
+    {
+#endif
     const GLchar* vertex_shader_with_version[2] = { bd->GlslVersionString, vertex_shader };
     GLuint vert_handle;
     GL_CALL(vert_handle = glCreateShader(GL_VERTEX_SHADER));
@@ -939,6 +2002,10 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
     bd->ShaderHandle = glCreateProgram();
     glAttachShader(bd->ShaderHandle, vert_handle);
     glAttachShader(bd->ShaderHandle, frag_handle);
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_PROGRAM_BINARY
+    if (bd->HasProgramBinary)
+        glProgramParameteri(bd->ShaderHandle, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+#endif
     glLinkProgram(bd->ShaderHandle);
     CheckProgram(bd->ShaderHandle, "shader program");
 
@@ -946,6 +2013,10 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
     glDetachShader(bd->ShaderHandle, frag_handle);
     glDeleteShader(vert_handle);
     glDeleteShader(frag_handle);
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_PROGRAM_BINARY
+    ImGui_ImplOpenGL3_SaveProgramBinary(vertex_shader, fragment_shader);
+    }
+#endif
 
     bd->AttribLocationTex = glGetUniformLocation(bd->ShaderHandle, "Texture");
     bd->AttribLocationProjMtx = glGetUniformLocation(bd->ShaderHandle, "ProjMtx");
@@ -956,6 +2027,9 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
     // Create buffers
     glGenBuffers(1, &bd->VboHandle);
     glGenBuffers(1, &bd->ElementsHandle);
+#if defined(IMGUI_DPF_BACKEND) && defined(IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY)
+    glGenVertexArrays(1, &bd->VaoHandle);
+#endif
 
     ImGui_ImplOpenGL3_CreateFontsTexture();
 
@@ -978,6 +2052,17 @@ void    ImGui_ImplOpenGL3_DestroyDeviceObjects()
     if (bd->VboHandle)      { glDeleteBuffers(1, &bd->VboHandle); bd->VboHandle = 0; }
     if (bd->ElementsHandle) { glDeleteBuffers(1, &bd->ElementsHandle); bd->ElementsHandle = 0; }
     if (bd->ShaderHandle)   { glDeleteProgram(bd->ShaderHandle); bd->ShaderHandle = 0; }
+#ifdef IMGUI_DPF_BACKEND
+#ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
+    if (bd->VaoHandle)      { glDeleteVertexArrays(1, &bd->VaoHandle); bd->VaoHandle = 0; }
+#endif
+    ImGui_ImplOpenGL3_DestroyCache();
+    bd->UploadBuffer.clear();
+#endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BUFFER_STREAMING
+    ImGui_ImplOpenGL3_DestroyStreamFences();
+    bd->StreamVertexSegmentSize = bd->StreamIndexSegmentSize = 0;
+#endif
     ImGui_ImplOpenGL3_DestroyFontsTexture();
 }
 
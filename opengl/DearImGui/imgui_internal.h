@@ -3600,6 +3600,32 @@ IMGUI_API void      ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_ta
 IMGUI_API void      ImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[256], unsigned char* pixels, int x, int y, int w, int h, int stride);
 IMGUI_API void      ImFontAtlasBuildGetOversampleFactors(const ImFontConfig* src, int* out_oversample_h, int* out_oversample_v);
 
+#ifdef IMGUI_DPF_BACKEND
+// DPF additions: dynamic glyphs, only Basic Latin is rasterized by Build() and other glyphs are rasterized and packed on first use (stb_truetype builder only).
+// Must be enabled before building the atlas. Font data and CPU-side texture data must be kept alive for as long as the atlas is used.
+// The texture is sized for all glyphs in the configured ranges up to 'max_tex_height', glyphs that do not fit anymore are left blank.
+// Backends call ImFontAtlasGetTexUpdateRows() to find which texture rows changed since their last upload, as identified by ImFontAtlasGetTexVersion().
+IMGUI_API void      ImFontAtlasBuildSetDynamicGlyphs(ImFontAtlas* atlas, bool enabled, int max_tex_height = 1024);
+IMGUI_API void      ImFontAtlasBuildDynamicGlyph(ImFont* font, ImFontGlyph* glyph);
+IMGUI_API int       ImFontAtlasGetTexVersion(ImFontAtlas* atlas);
+IMGUI_API bool      ImFontAtlasGetTexUpdateRows(ImFontAtlas* atlas, int since_version, int* out_y, int* out_height);
+#endif
+
+#ifdef IMGUI_DPF_TEXT_SIZE_CACHE
+// DPF additions: cache of ImFont::CalcTextSizeA() results, see imconfig.h. The hit rate is Hits / (Hits + Misses).
+struct ImFontTextSizeCacheStats
+{
+    int                 Hits;               // Calls answered from the cache
+    int                 Misses;             // Calls that measured text and added it to the cache
+    int                 Evictions;          // Entries replaced to make room for others
+    int                 Clears;             // Times the cache was cleared because a font changed
+    ImFontTextSizeCacheStats() { memset(this, 0, sizeof(*this)); }
+};
+IMGUI_API void      ImFontTextSizeCacheClear();
+IMGUI_API void      ImFontTextSizeCacheGetStats(ImFontTextSizeCacheStats* out_stats);
+IMGUI_API void      ImFontTextSizeCacheResetStats();
+#endif
+
 IMGUI_API bool      ImFontAtlasGetMouseCursorTexData(ImFontAtlas* atlas, ImGuiMouseCursor cursor_type, ImVec2* out_offset, ImVec2* out_size, ImVec2 out_uv_border[2], ImVec2 out_uv_fill[2]);
 
 //-----------------------------------------------------------------------------
@@ -8109,6 +8109,9 @@ void ImGuiSelectionBasicStorage::Clear()
     Size = 0;
     _SelectionOrder = 1; // Always >0
     _Storage.Data.resize(0);
+#ifdef IMGUI_DPF_STORAGE_HASH_MAP
+    _Storage._IndexedCount = -1; // DPF: Index no longer matches Data
+#endif
 }
 
 void ImGuiSelectionBasicStorage::Swap(ImGuiSelectionBasicStorage& r)
@@ -8116,6 +8119,10 @@ void ImGuiSelectionBasicStorage::Swap(ImGuiSelectionBasicStorage& r)
     ImSwap(Size, r.Size);
     ImSwap(_SelectionOrder, r._SelectionOrder);
     _Storage.Data.swap(r._Storage.Data);
+#ifdef IMGUI_DPF_STORAGE_HASH_MAP
+    _Storage._Index.swap(r._Storage._Index);
+    ImSwap(_Storage._IndexedCount, r._Storage._IndexedCount);
+#endif
 }
 
 bool ImGuiSelectionBasicStorage::Contains(ImGuiID id) const
@@ -8137,7 +8144,12 @@ bool ImGuiSelectionBasicStorage::GetNextSelectedItem(void** opaque_it, ImGuiID*
     ImGuiStoragePair* it = (ImGuiStoragePair*)*opaque_it;
     ImGuiStoragePair* it_end = _Storage.Data.Data + _Storage.Data.Size;
     if (PreserveOrder && it == NULL && it_end != NULL)
+    {
         ImQsort(_Storage.Data.Data, (size_t)_Storage.Data.Size, sizeof(ImGuiStoragePair), PairComparerByValueInt); // ~ImGuiStorage::BuildSortByValueInt()
+#ifdef IMGUI_DPF_STORAGE_HASH_MAP
+        _Storage._IndexedCount = -1; // DPF: Index no longer matches Data
+#endif
+    }
     if (it == NULL)
         it = _Storage.Data.Data;
     IM_ASSERT(it >= _Storage.Data.Data && it <= it_end);
@@ -8163,6 +8175,13 @@ void ImGuiSelectionBasicStorage::SetItemSelected(ImGuiID id, bool selected)
 static void ImGuiSelectionBasicStorage_BatchSetItemSelected(ImGuiSelectionBasicStorage* selection, ImGuiID id, bool selected, int size_before_amends, int selection_order)
 {
     ImGuiStorage* storage = &selection->_Storage;
+#ifdef IMGUI_DPF_STORAGE_HASH_MAP
+    // DPF: Data is not sorted with the hash map storage, but lookups and insertions are cheap anyway
+    IM_UNUSED(size_before_amends);
+    if (selected == (storage->GetInt(id, 0) != 0))
+        return;
+    storage->SetInt(id, selected ? selection_order : 0);
+#else
     ImGuiStoragePair* it = ImLowerBound(storage->Data.Data, storage->Data.Data + size_before_amends, id);
     const bool is_contained = (it != storage->Data.Data + size_before_amends) && (it->key == id);
     if (selected == (is_contained && it->val_i != 0))
@@ -8171,6 +8190,7 @@ static void ImGuiSelectionBasicStorage_BatchSetItemSelected(ImGuiSelectionBasicS
         storage->Data.push_back(ImGuiStoragePair(id, selection_order)); // Push unsorted at end of vector, will be sorted in SelectionMultiAmendsFinish()
     else if (is_contained)
         it->val_i = selected ? selection_order : 0; // Modify in-place.
+#endif
     selection->Size += selected ? +1 : -1;
 }
 
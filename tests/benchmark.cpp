@@ -0,0 +1,481 @@
+/*
+ * DISTRHO Plugin Framework (DPF)
+ * Copyright (C) 2012-2024 Filipe Coelho <falktx@falktx.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any purpose with
+ * or without fee is hereby granted, provided that the above copyright notice and this
+ * permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD
+ * TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS. IN
+ * NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER
+ * IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+// Headless benchmark of ImGui frame generation and rendering, using the same setup as ImGuiWidget.
+// Renders into an offscreen framebuffer of a surfaceless EGL context (e.g. Mesa llvmpipe), no display needed.
+// Results are printed as one JSON object per line, one line per scenario.
+//
+// Usage: benchmark [num-frames]
+
+#define IMGUI_DPF_BACKEND
+#define GL_GLEXT_PROTOTYPES
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#include <GL/gl.h>
+#include <GL/glext.h>
+
+#include "../opengl/DearImGui/imgui.h"
+#include "../opengl/DearImGuiColorTextEditor/TextEditor.h"
+#include "../opengl/DearImGuiKnobs/imgui-knobs.h"
+#include "../opengl/DearImGuiToggle/imgui_toggle.h"
+
+#if defined(DGL_USE_GLES2) || defined(DGL_USE_GLES3) || defined(DGL_USE_OPENGL3)
+# include "../opengl/DearImGui/imgui_impl_opengl3.h"
+#else
+# include "../opengl/DearImGui/imgui_impl_opengl2.h"
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+// --------------------------------------------------------------------------------------------------------------------
+
+static constexpr const int kWidth = 1280;
+static constexpr const int kHeight = 720;
+static constexpr const int kDefaultNumFrames = 1000;
+static constexpr const int kNumWarmupFrames = 30;
+
+static GLuint gFramebuffer = 0;
+static GLuint gFramebufferTexture = 0;
+
+static size_t gNumAllocations = 0;
+static size_t gAllocatedBytes = 0;
+
+static void* countingAlloc(const size_t size, void*)
+{
+    ++gNumAllocations;
+    gAllocatedBytes += size;
+    return std::malloc(size);
+}
+
+static void countingFree(void* const ptr, void*)
+{
+    std::free(ptr);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+static bool createContext()
+{
+    const PFNEGLGETPLATFORMDISPLAYEXTPROC eglGetPlatformDisplayEXT
+        = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+
+    if (eglGetPlatformDisplayEXT == nullptr)
+        return false;
+
+    const EGLDisplay display = eglGetPlatformDisplayEXT(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+
+    EGLint major, minor;
+    if (display == EGL_NO_DISPLAY || ! eglInitialize(display, &major, &minor))
+        return false;
+
+   #if defined(DGL_USE_GLES2) || defined(DGL_USE_GLES3)
+    eglBindAPI(EGL_OPENGL_ES_API);
+    const EGLint attribs[] = {
+      #ifdef DGL_USE_GLES3
+        EGL_CONTEXT_MAJOR_VERSION, 3,
+      #else
+        EGL_CONTEXT_MAJOR_VERSION, 2,
+      #endif
+        EGL_NONE
+    };
+   #elif defined(DGL_USE_OPENGL3)
+    eglBindAPI(EGL_OPENGL_API);
+    const EGLint attribs[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 3,
+        EGL_CONTEXT_MINOR_VERSION, 3,
+        EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+        EGL_NONE
+    };
+   #else
+    eglBindAPI(EGL_OPENGL_API);
+    const EGLint attribs[] = {
+        EGL_CONTEXT_MAJOR_VERSION, 2,
+        EGL_CONTEXT_MINOR_VERSION, 1,
+        EGL_NONE
+    };
+   #endif
+
+    const EGLContext context = eglCreateContext(display, EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, attribs);
+
+    if (context == EGL_NO_CONTEXT || ! eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context))
+        return false;
+
+    // offscreen framebuffer standing in for the window
+    glGenTextures(1, &gFramebufferTexture);
+    glBindTexture(GL_TEXTURE_2D, gFramebufferTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, kWidth, kHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glGenFramebuffers(1, &gFramebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, gFramebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, gFramebufferTexture, 0);
+
+    // DPF enables alpha-blending when setting up the window, no vertex array object is bound
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+    return glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE;
+}
+
+// same GL state as DPF sets up before calling widget onDisplay()
+static void prepareWindow()
+{
+    glBindFramebuffer(GL_FRAMEBUFFER, gFramebuffer);
+    glViewport(0, 0, kWidth, kHeight);
+    glClearColor(0.f, 0.f, 0.f, 1.f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+   #if !(defined(DGL_USE_GLES2) || defined(DGL_USE_GLES3) || defined(DGL_USE_OPENGL3))
+    glMatrixMode(GL_PROJECTION);
+    glLoadIdentity();
+    glOrtho(0.0, kWidth, kHeight, 0.0, 0.0, 1.0);
+    glMatrixMode(GL_MODELVIEW);
+    glLoadIdentity();
+   #endif
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// scripted input, the same for every scenario
+
+static void feedInput(ImGuiIO& io, const int frame)
+{
+    // pointer moving around in circles, covering most of the window
+    const float angle = frame * 0.05f;
+    io.AddMousePosEvent(kWidth * (0.5f + 0.4f * std::cos(angle)),
+                        kHeight * (0.5f + 0.4f * std::sin(angle * 1.3f)));
+
+    // click every now and then, drag for a few frames
+    if (frame % 90 == 0)
+        io.AddMouseButtonEvent(ImGuiMouseButton_Left, true);
+    else if (frame % 90 == 5)
+        io.AddMouseButtonEvent(ImGuiMouseButton_Left, false);
+
+    // scroll back and forth
+    if (frame % 30 == 15)
+        io.AddMouseWheelEvent(0.f, (frame / 30) % 4 < 2 ? -1.f : 1.f);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// scenarios
+
+static void showDemoWindow()
+{
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(kWidth, kHeight));
+    ImGui::ShowDemoWindow();
+}
+
+static void showWidgets()
+{
+    static float knobs[32] = {};
+    static bool toggles[32] = {};
+
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(kWidth, kHeight));
+
+    if (ImGui::Begin("Widgets", nullptr, ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoCollapse))
+    {
+        char label[32];
+
+        for (int i = 0; i < 32; ++i)
+        {
+            std::snprintf(label, sizeof(label), "Knob %d", i + 1);
+            ImGuiKnobs::Knob(label, &knobs[i], 0.f, 1.f, 0.f, "%.2f", static_cast<ImGuiKnobVariant>(1 << (i % 7)));
+
+            if (i % 8 != 7)
+                ImGui::SameLine();
+        }
+
+        for (int i = 0; i < 32; ++i)
+        {
+            std::snprintf(label, sizeof(label), "Toggle %d", i + 1);
+            ImGui::Toggle(label, &toggles[i], ImGuiToggleFlags_Animated);
+
+            if (i % 8 != 7)
+                ImGui::SameLine();
+        }
+    }
+
+    ImGui::End();
+}
+
+// many labeled widgets, mostly about ID hashing and layout, clipped or not
+static void showLabels()
+{
+    static bool checks[500] = {};
+    static float values[500] = {};
+
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(kWidth, kHeight));
+
+    if (ImGui::Begin("Labels", nullptr, ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoCollapse))
+    {
+        char label[64];
+
+        for (int i = 0; i < 500; ++i)
+        {
+            ImGui::PushID(i);
+            std::snprintf(label, sizeof(label), "Parameter number %d with a long label##param", i + 1);
+            ImGui::Checkbox(label, &checks[i]);
+            ImGui::SameLine();
+            ImGui::SliderFloat("##value", &values[i], 0.f, 1.f);
+            ImGui::SameLine();
+            ImGui::SmallButton("Reset");
+            ImGui::PopID();
+        }
+    }
+
+    ImGui::End();
+}
+
+// large tree getting expanded over time, mostly about ImGuiStorage lookups and insertions
+static void showTree()
+{
+    static int numExpanded = 0;
+
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(kWidth, kHeight));
+
+    if (ImGui::Begin("Tree", nullptr, ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoCollapse))
+    {
+        // expand 20 more nodes every frame, storing their state for the first time
+        numExpanded = std::min(numExpanded + 20, 10000);
+
+        for (int i = 0; i < 10000; ++i)
+        {
+            if (i < numExpanded)
+                ImGui::SetNextItemOpen(true, ImGuiCond_Once);
+
+            if (ImGui::TreeNode(reinterpret_cast<void*>(static_cast<intptr_t>(i)), "Node %d", i))
+                ImGui::TreePop();
+        }
+    }
+
+    ImGui::End();
+}
+
+// oscilloscope and envelope style drawing, mostly about polyline and polygon tessellation
+static void showPolylines()
+{
+    static int frame = 0;
+    static ImVec2 points[4096];
+
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(kWidth, kHeight));
+
+    if (ImGui::Begin("Polylines", nullptr, ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoCollapse))
+    {
+        ImDrawList* const drawList = ImGui::GetWindowDrawList();
+        const ImVec2 origin = ImGui::GetCursorScreenPos();
+        const float phase = static_cast<float>(frame++) * 0.05f;
+
+        for (int line = 0; line < 4; ++line)
+        {
+            const float y = origin.y + 80.f + 150.f * static_cast<float>(line);
+
+            for (int i = 0; i < 4096; ++i)
+                points[i] = ImVec2(origin.x + static_cast<float>(i) * 0.3f,
+                                   y + 60.f * std::sin(static_cast<float>(i) * 0.02f + phase) * std::cos(static_cast<float>(i) * 0.0031f * static_cast<float>(line + 1)));
+
+            drawList->AddPolyline(points, 4096, IM_COL32(255, 200, 0, 255), ImDrawFlags_None, line < 2 ? 1.f : 2.5f);
+        }
+
+        // convex envelope shape
+        for (int i = 0; i < 2048; ++i)
+        {
+            const float angle = static_cast<float>(i) * (6.2831855f / 2048.f);
+            points[i] = ImVec2(origin.x + 1000.f + 120.f * std::cos(angle), origin.y + 300.f + 200.f * std::sin(angle));
+        }
+
+        drawList->AddConvexPolyFilled(points, 2048, IM_COL32(0, 160, 255, 128));
+    }
+
+    ImGui::End();
+}
+
+static TextEditor* gTextEditor = nullptr;
+
+static void showTextEditor()
+{
+    ImGui::SetNextWindowPos(ImVec2(0, 0));
+    ImGui::SetNextWindowSize(ImVec2(kWidth, kHeight));
+
+    if (ImGui::Begin("TextEditor", nullptr, ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoCollapse))
+        gTextEditor->Render("##editor");
+
+    ImGui::End();
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+struct Scenario {
+    const char* name;
+    void (*display)();
+};
+
+static double getPercentile(std::vector<double> values, const double percentile)
+{
+    std::sort(values.begin(), values.end());
+    const size_t index = std::min(values.size() - 1, static_cast<size_t>(percentile * values.size()));
+    return values[index];
+}
+
+static void runScenario(const Scenario& scenario, const int numFrames)
+{
+    ImGuiContext* const context = ImGui::CreateContext();
+    ImGui::SetCurrentContext(context);
+
+    ImGuiIO& io(ImGui::GetIO());
+    io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;
+    io.DisplaySize = ImVec2(kWidth, kHeight);
+    io.IniFilename = nullptr;
+    io.LogFilename = nullptr;
+
+   #if defined(DGL_USE_GLES2) || defined(DGL_USE_GLES3) || defined(DGL_USE_OPENGL3)
+    ImGui_ImplOpenGL3_Init();
+   #else
+    ImGui_ImplOpenGL2_Init();
+   #endif
+
+    std::vector<double> cpuTimes, totalTimes;
+    cpuTimes.reserve(numFrames);
+    totalTimes.reserve(numFrames);
+
+    size_t numAllocations = 0;
+    size_t allocatedBytes = 0;
+
+    for (int frame = -kNumWarmupFrames; frame < numFrames; ++frame)
+    {
+        io.DeltaTime = 1.f / 60.f;
+        feedInput(io, frame + kNumWarmupFrames);
+
+        const size_t numAllocationsBefore = gNumAllocations;
+        const size_t allocatedBytesBefore = gAllocatedBytes;
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+       #if defined(DGL_USE_GLES2) || defined(DGL_USE_GLES3) || defined(DGL_USE_OPENGL3)
+        ImGui_ImplOpenGL3_NewFrame();
+       #else
+        ImGui_ImplOpenGL2_NewFrame();
+       #endif
+
+        ImGui::NewFrame();
+        scenario.display();
+        ImGui::Render();
+
+        const std::chrono::steady_clock::time_point cpuEnd = std::chrono::steady_clock::now();
+
+        prepareWindow();
+
+       #if defined(DGL_USE_GLES2) || defined(DGL_USE_GLES3) || defined(DGL_USE_OPENGL3)
+        ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+       #else
+        ImGui_ImplOpenGL2_RenderDrawData(ImGui::GetDrawData());
+       #endif
+
+        // wait for the GPU, so that GL submission cost is included
+        glFinish();
+
+        const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+        if (frame < 0)
+            continue;
+
+        cpuTimes.push_back(std::chrono::duration<double, std::milli>(cpuEnd - start).count());
+        totalTimes.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+        numAllocations += gNumAllocations - numAllocationsBefore;
+        allocatedBytes += gAllocatedBytes - allocatedBytesBefore;
+    }
+
+    double totalSum = 0.0;
+    for (double time : totalTimes)
+        totalSum += time;
+
+    std::printf("{\"scenario\":\"%s\",\"frames\":%d,\"width\":%d,\"height\":%d,"
+                "\"cpu_p50_ms\":%.4f,\"cpu_p99_ms\":%.4f,"
+                "\"frame_p50_ms\":%.4f,\"frame_p99_ms\":%.4f,\"frame_mean_ms\":%.4f,"
+                "\"allocs_per_frame\":%.2f,\"alloc_bytes_per_frame\":%.1f}\n",
+                scenario.name, numFrames, kWidth, kHeight,
+                getPercentile(cpuTimes, 0.5), getPercentile(cpuTimes, 0.99),
+                getPercentile(totalTimes, 0.5), getPercentile(totalTimes, 0.99), totalSum / numFrames,
+                static_cast<double>(numAllocations) / numFrames,
+                static_cast<double>(allocatedBytes) / numFrames);
+    std::fflush(stdout);
+
+   #if defined(DGL_USE_GLES2) || defined(DGL_USE_GLES3) || defined(DGL_USE_OPENGL3)
+    ImGui_ImplOpenGL3_Shutdown();
+   #else
+    ImGui_ImplOpenGL2_Shutdown();
+   #endif
+
+    ImGui::DestroyContext(context);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    const int numFrames = argc > 1 ? std::atoi(argv[1]) : kDefaultNumFrames;
+
+    if (numFrames <= 0)
+    {
+        std::fprintf(stderr, "usage: %s [num-frames]\n", argv[0]);
+        return 1;
+    }
+
+    if (! createContext())
+    {
+        std::fprintf(stderr, "failed to create a surfaceless EGL context\n");
+        return 1;
+    }
+
+    std::fprintf(stderr, "%s | %s\n", glGetString(GL_RENDERER), glGetString(GL_VERSION));
+
+    // count all ImGui allocations, including the ones done by our widgets
+    ImGui::SetAllocatorFunctions(countingAlloc, countingFree);
+
+    TextEditor textEditor;
+    textEditor.SetLanguageDefinition(TextEditor::LanguageDefinition::CPlusPlus());
+    {
+        std::string text;
+        for (int i = 0; i < 200; ++i)
+            text += "static int function(const float value) { return static_cast<int>(value * 2.f); } // comment\n";
+        textEditor.SetText(text);
+    }
+    gTextEditor = &textEditor;
+
+    const Scenario scenarios[] = {
+        { "demo", showDemoWindow },
+        { "widgets", showWidgets },
+        { "labels", showLabels },
+        { "tree", showTree },
+        { "polylines", showPolylines },
+        { "texteditor", showTextEditor },
+    };
+
+    for (const Scenario& scenario : scenarios)
+        runScenario(scenario, numFrames);
+
+    return 0;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,156 @@
+/*
+ * DISTRHO Plugin Framework (DPF)
+ * Copyright (C) 2012-2024 Filipe Coelho <falktx@falktx.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any purpose with
+ * or without fee is hereby granted, provided that the above copyright notice and this
+ * permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD
+ * TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS. IN
+ * NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER
+ * IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+// Hashes random buffers and strings with ImHashData() and ImHashStr(), and prints the results, one line per test case.
+// The Makefile builds this twice, with and without the CRC32 instructions dispatch of imgui.cpp,
+// output of both builds must be exactly the same (see the run-hash-compare target).
+// Only meaningful on a CPU with CRC32 instructions (SSE 4.2 or ARMv8 CRC), otherwise both builds use the lookup table.
+//
+// Usage: hash-compare [num-cases]
+
+#define IMGUI_DPF_BACKEND
+
+#include "../opengl/DearImGui/imgui.h"
+#include "../opengl/DearImGui/imgui_internal.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+// --------------------------------------------------------------------------------------------------------------------
+
+static constexpr const int kDefaultNumCases = 10000;
+static constexpr const int kMaxLength = 80;
+
+// simple LCG, so that cases are the same on every platform
+static uint32_t gRandomState = 1;
+
+static uint32_t getRandom(const uint32_t max)
+{
+    gRandomState = gRandomState * 1664525u + 1013904223u;
+    return (gRandomState >> 8) % max;
+}
+
+static ImGuiID getRandomSeed()
+{
+    switch (getRandom(4))
+    {
+    case 0:
+        return 0;
+    case 1:
+        return ~0u;
+    default:
+        return (getRandom(0x10000) << 16) | getRandom(0x10000);
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// random bytes of all lengths, from unaligned offsets, so that both 8-byte blocks and the remaining bytes are covered
+
+static void compareData(const int numCases)
+{
+    std::vector<unsigned char> buffer(kMaxLength + 8);
+
+    for (int i = 0; i < numCases; ++i)
+    {
+        const int offset = getRandom(8);
+        const int size = i % 4 == 0 ? i / 4 % (kMaxLength + 1) : getRandom(kMaxLength + 1);
+        const ImGuiID seed = getRandomSeed();
+
+        for (size_t j = 0; j < buffer.size(); ++j)
+            buffer[j] = getRandom(256);
+
+        std::printf("data %d: size %d, seed %08x, hash %08x\n",
+                    i, size, seed, ImHashData(buffer.data() + offset, size, seed));
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// strings of all lengths, with "##" and "###" around 8-byte boundaries, and bytes close to '#' for the 8-byte fast path
+
+static void compareStrings(const int numCases)
+{
+    static const char* const pieces[] = {
+        "#", "##", "###", "####", "Hello", "World", "0123456789", " ", "/", "\"", "$", "\xA3", "\xC3\xA9", "\x7F", "\x80",
+    };
+
+    std::string text;
+
+    for (int i = 0; i < numCases; ++i)
+    {
+        const ImGuiID seed = getRandomSeed();
+        text.clear();
+
+        switch (getRandom(3))
+        {
+        // only pieces
+        case 0:
+            for (int j = getRandom(12); j > 0; --j)
+                text += pieces[getRandom(IM_ARRAYSIZE(pieces))];
+            break;
+        // random printable text, "###" placed at a random position
+        case 1:
+            for (int j = getRandom(kMaxLength + 1); j > 0; --j)
+                text += static_cast<char>(' ' + getRandom(95));
+            text.insert(getRandom(static_cast<uint32_t>(text.size()) + 1), "###");
+            break;
+        // random bytes, without zero so that it is also a valid zero-terminated string
+        default:
+            for (int j = getRandom(kMaxLength + 1); j > 0; --j)
+                text += static_cast<char>(1 + getRandom(255));
+            break;
+        }
+
+        // ImHashStr() stops at the end of the string if given no size, so compare both ways
+        std::printf("string %d: size %d, seed %08x, hash %08x %08x\n",
+                    i, static_cast<int>(text.size()), seed,
+                    ImHashStr(text.c_str(), text.size(), seed), ImHashStr(text.c_str(), 0, seed));
+    }
+
+    // zero bytes are hashed too when the size is known
+    for (int i = 0; i < numCases / 10; ++i)
+    {
+        const ImGuiID seed = getRandomSeed();
+        text.clear();
+
+        for (int j = 1 + getRandom(kMaxLength); j > 0; --j)
+            text += static_cast<char>(getRandom(4) == 0 ? 0 : getRandom(4) == 0 ? '#' : getRandom(256));
+
+        std::printf("sized string %d: size %d, seed %08x, hash %08x\n",
+                    i, static_cast<int>(text.size()), seed, ImHashStr(text.data(), text.size(), seed));
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    const int numCases = argc > 1 ? std::atoi(argv[1]) : kDefaultNumCases;
+
+    if (numCases <= 0)
+    {
+        std::fprintf(stderr, "usage: %s [num-cases]\n", argv[0]);
+        return 1;
+    }
+
+    compareData(numCases);
+    compareStrings(numCases);
+    return 0;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
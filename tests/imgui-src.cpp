@@ -21,6 +21,11 @@
 #include "../opengl/DearImGui/imgui_draw.cpp"
 #include "../opengl/DearImGui/imgui_tables.cpp"
 #include "../opengl/DearImGui/imgui_widgets.cpp"
+#include "../opengl/DearImGuiKnobs/imgui-knobs.cpp"
+#include "../opengl/DearImGuiToggle/imgui_toggle.cpp"
+#include "../opengl/DearImGuiToggle/imgui_toggle_palette.cpp"
+#include "../opengl/DearImGuiToggle/imgui_toggle_presets.cpp"
+#include "../opengl/DearImGuiToggle/imgui_toggle_renderer.cpp"
 #include "../opengl/DearImGuiColorTextEditor/TextEditor.cpp"
 
 #if defined(DGL_USE_GLES2)
@@ -0,0 +1,195 @@
+/*
+ * DISTRHO Plugin Framework (DPF)
+ * Copyright (C) 2012-2024 Filipe Coelho <falktx@falktx.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any purpose with
+ * or without fee is hereby granted, provided that the above copyright notice and this
+ * permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD
+ * TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS. IN
+ * NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER
+ * IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+// Draws random shapes and text, and prints a hash of the generated vertices and indices, one line per test case.
+// The Makefile builds this twice, with and without the SIMD drawing code of imgui_draw.cpp,
+// output of both builds must be exactly the same (see the run-simd-compare target).
+// No OpenGL context nor display is needed.
+//
+// Usage: simd-compare [num-cases]
+
+#define IMGUI_DPF_BACKEND
+
+#include "../opengl/DearImGui/imgui.h"
+#include "../opengl/DearImGui/imgui_internal.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+// --------------------------------------------------------------------------------------------------------------------
+
+static constexpr const int kDefaultNumCases = 10000;
+
+// simple LCG, so that cases are the same on every platform
+static uint32_t gRandomState = 1;
+
+static uint32_t getRandom(const uint32_t max)
+{
+    gRandomState = gRandomState * 1664525u + 1013904223u;
+    return (gRandomState >> 8) % max;
+}
+
+static float getRandomFloat(const float max)
+{
+    return static_cast<float>(getRandom(1000000)) * (max / 1000000.f);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+static void resetDrawList(ImDrawList* const drawList, const ImDrawListFlags flags)
+{
+    drawList->_ResetForNewFrame();
+    drawList->PushClipRectFullScreen();
+    drawList->PushTextureID(ImGui::GetIO().Fonts->TexID);
+    drawList->Flags = flags;
+}
+
+static void printDrawList(const char* const name, const int index, const ImDrawList* const drawList)
+{
+    ImGuiID hash = ImHashData(drawList->VtxBuffer.Data, sizeof(ImDrawVert) * drawList->VtxBuffer.Size);
+    hash = ImHashData(drawList->IdxBuffer.Data, sizeof(ImDrawIdx) * drawList->IdxBuffer.Size, hash);
+
+    std::printf("%s %d: %d vertices, %d indices, hash %08x\n",
+                name, index, drawList->VtxBuffer.Size, drawList->IdxBuffer.Size, hash);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// polylines and filled polygons, all anti-aliasing modes, odd and even point counts, zero-length segments
+
+static void comparePolygons(ImDrawList* const drawList, const int numCases)
+{
+    static const float thicknesses[] = { 0.5f, 1.f, 1.5f, 2.f, 3.f, 7.25f };
+    static const ImDrawListFlags flags[] = {
+        ImDrawListFlags_None,
+        ImDrawListFlags_AntiAliasedLines,
+        ImDrawListFlags_AntiAliasedLines | ImDrawListFlags_AntiAliasedLinesUseTex,
+        ImDrawListFlags_AntiAliasedFill,
+    };
+
+    std::vector<ImVec2> points;
+
+    for (int i = 0; i < numCases; ++i)
+    {
+        const int numPoints = i % 7 == 0 ? 2 + getRandom(3) : 2 + getRandom(60);
+        points.resize(numPoints);
+
+        for (int j = 0; j < numPoints; ++j)
+        {
+            if (j != 0 && getRandom(10) == 0)
+                points[j] = points[j - 1];
+            else
+                points[j] = ImVec2(getRandomFloat(1300.f), getRandomFloat(760.f));
+        }
+
+        resetDrawList(drawList, flags[getRandom(IM_ARRAYSIZE(flags))] | ImDrawListFlags_AntiAliasedFill);
+
+        drawList->AddPolyline(points.data(), numPoints, IM_COL32(getRandom(256), 20, 30, 200),
+                              getRandom(2) ? ImDrawFlags_Closed : ImDrawFlags_None,
+                              thicknesses[getRandom(IM_ARRAYSIZE(thicknesses))]);
+
+        if (numPoints >= 3)
+        {
+            drawList->AddConvexPolyFilled(points.data(), numPoints, IM_COL32(1, 2, 3, 255));
+            drawList->AddConcavePolyFilled(points.data(), numPoints, IM_COL32(1, 2, 3, 255));
+        }
+
+        printDrawList("polygon", i, drawList);
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// text with and without word wrapping and fine clipping, partially clipped, with missing and remapped glyphs
+
+static void compareText(ImDrawList* const drawList, ImFont* const* const fonts, const int numFonts, const int numCases)
+{
+    static const char* const pieces[] = {
+        "Hello", " ", "World", "\n", "\r", "\t", "0.123", "##", "MMMMMMMMMMMMMMMM", "iiiiii", "\x01",
+        "\xC3\xA9", "\xE2\x82\xAC", "\xF0\x9F\x98\x80", "\xFF",
+    };
+
+    std::string text;
+
+    for (int i = 0; i < numCases; ++i)
+    {
+        text.clear();
+        for (int j = getRandom(30); j > 0; --j)
+            text += pieces[getRandom(IM_ARRAYSIZE(pieces))];
+
+        resetDrawList(drawList, ImDrawListFlags_None);
+
+        ImFont* const font = fonts[getRandom(numFonts)];
+        const float size = 8.f + getRandomFloat(28.f);
+        const ImVec2 pos(getRandomFloat(1300.f) - 100.f, getRandomFloat(800.f) - 50.f);
+        const float clipX = getRandom(600);
+        const float clipY = getRandom(400);
+        const ImVec4 clipRect(clipX, clipY, clipX + 300.f + getRandom(1000), clipY + 200.f + getRandom(600));
+        const float wrapWidth = getRandom(5) == 0 ? 50.f + getRandom(200) : 0.f;
+        const bool cpuFineClip = getRandom(5) == 0;
+
+        font->RenderText(drawList, size, pos, IM_COL32(getRandom(256), 1, 2, 200), clipRect,
+                         text.c_str(), text.c_str() + text.size(), wrapWidth, cpuFineClip);
+
+        printDrawList("text", i, drawList);
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    const int numCases = argc > 1 ? std::atoi(argv[1]) : kDefaultNumCases;
+
+    if (numCases <= 0)
+    {
+        std::fprintf(stderr, "usage: %s [num-cases]\n", argv[0]);
+        return 1;
+    }
+
+    ImGuiContext* const context = ImGui::CreateContext();
+
+    ImGuiIO& io(ImGui::GetIO());
+    io.DisplaySize = ImVec2(1280, 720);
+    io.IniFilename = nullptr;
+    io.LogFilename = nullptr;
+
+    // same font setup as ImGuiWidget, glyphs above ASCII are rasterized on first use
+    ImFontAtlasBuildSetDynamicGlyphs(io.Fonts, true);
+    ImFont* const fonts[] = { io.Fonts->AddFontDefault(), io.Fonts->AddFontDefault() };
+    io.Fonts->Build();
+
+    // ASCII characters pointing to glyphs that are not rasterized yet
+    fonts[1]->AddRemapChar('o', 0xF6);
+    fonts[1]->AddRemapChar('W', 0xC6);
+    fonts[1]->AddRemapChar('i', 0xEF);
+
+    // sets up shared draw list data
+    ImGui::NewFrame();
+    ImGui::Render();
+
+    ImDrawList* const drawList = IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData());
+
+    comparePolygons(drawList, numCases);
+    compareText(drawList, fonts, IM_ARRAYSIZE(fonts), numCases);
+
+    IM_DELETE(drawList);
+    ImGui::DestroyContext(context);
+    return 0;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,432 @@
+/*
+ * DISTRHO Plugin Framework (DPF)
+ * Copyright (C) 2012-2024 Filipe Coelho <falktx@falktx.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for any purpose with
+ * or without fee is hereby granted, provided that the above copyright notice and this
+ * permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES WITH REGARD
+ * TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS. IN
+ * NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER
+ * IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF OR IN
+ * CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+ */
+
+// Runs random sequences of ImGuiStorage and ImGuiSelectionBasicStorage operations and checks them against std::map,
+// including direct changes to ImGuiStorage::Data as done by ImGuiSelectionBasicStorage, then times the most common operations.
+// The Makefile builds this twice, with and without IMGUI_DPF_STORAGE_HASH_MAP (see the run-storage-test target).
+// Errors are printed to stderr, benchmark results as one JSON object per line, one line per storage size.
+//
+// Usage: storage-test [num-operations]
+
+#define IMGUI_DPF_BACKEND
+
+#include "../opengl/DearImGui/imgui.h"
+#include "../opengl/DearImGui/imgui_internal.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <map>
+#include <utility>
+#include <vector>
+
+// --------------------------------------------------------------------------------------------------------------------
+
+static constexpr const int kDefaultNumOperations = 200000;
+
+// int and pointer values are never stored under the same key, as ImGuiStorage does not store value types
+static constexpr const ImGuiID kPointerKeyBit = 0x80000000u;
+
+// simple LCG, so that cases are the same on every platform
+static uint32_t gRandomState = 1;
+
+static uint32_t getRandom(const uint32_t max)
+{
+    gRandomState = gRandomState * 1664525u + 1013904223u;
+    return (gRandomState >> 8) % max;
+}
+
+// hashes as used for IDs, plain indices and multiples of large powers of two
+static ImGuiID getRandomKey(const uint32_t poolSize)
+{
+    const uint32_t n = getRandom(poolSize);
+
+    switch (n % 3)
+    {
+    case 0:
+        return ImHashData(&n, sizeof(n)) & ~kPointerKeyBit;
+    case 1:
+        return n;
+    default:
+        return (n << 12) & ~kPointerKeyBit;
+    }
+}
+
+static void* getPointer(const uint32_t value)
+{
+    return reinterpret_cast<void*>(static_cast<uintptr_t>(value) + 1);
+}
+
+static int gNumErrors = 0;
+
+#define CHECK(cond) \
+    do { if (!(cond)) { std::fprintf(stderr, "check failed at line %d, operation %d: %s\n", __LINE__, op, #cond); ++gNumErrors; } } while (false)
+
+// --------------------------------------------------------------------------------------------------------------------
+
+struct StorageReference {
+    std::map<ImGuiID, int> ints;
+    std::map<ImGuiID, void*> pointers;
+
+    void clear()
+    {
+        ints.clear();
+        pointers.clear();
+    }
+
+    void erase(const ImGuiID key)
+    {
+        if (key & kPointerKeyBit)
+            pointers.erase(key);
+        else
+            ints.erase(key);
+    }
+};
+
+// every pair is looked up, and contents must be the same as the reference
+static void checkStorage(const ImGuiStorage& storage, const StorageReference& ref, const int op)
+{
+    CHECK(storage.Data.Size == static_cast<int>(ref.ints.size() + ref.pointers.size()));
+
+    for (const ImGuiStoragePair& pair : storage.Data)
+    {
+        if (pair.key & kPointerKeyBit)
+        {
+            const std::map<ImGuiID, void*>::const_iterator it = ref.pointers.find(pair.key);
+            CHECK(it != ref.pointers.end() && it->second == pair.val_p);
+        }
+        else
+        {
+            const std::map<ImGuiID, int>::const_iterator it = ref.ints.find(pair.key);
+            CHECK(it != ref.ints.end() && it->second == pair.val_i);
+        }
+    }
+
+    for (const std::pair<const ImGuiID, int>& it : ref.ints)
+        CHECK(storage.GetInt(it.first, -1) == it.second);
+
+    for (const std::pair<const ImGuiID, void*>& it : ref.pointers)
+        CHECK(storage.GetVoidPtr(it.first) == it.second);
+}
+
+static void testStorage(const int numOperations)
+{
+    ImGuiStorage storage;
+    StorageReference ref;
+    uint32_t poolSize = 64;
+
+    for (int op = 0; op < numOperations; ++op)
+    {
+        // alternate between small and large storages
+        if (op % 20000 == 0)
+            poolSize = poolSize == 64 ? 4096 : 64;
+
+        const uint32_t action = getRandom(100);
+        const uint32_t value = getRandom(1000000);
+        const ImGuiID key = getRandomKey(poolSize);
+        const ImGuiID pointerKey = key | kPointerKeyBit;
+
+        if (action < 25)
+        {
+            storage.SetInt(key, value);
+            ref.ints[key] = value;
+        }
+        else if (action < 45)
+        {
+            const std::map<ImGuiID, int>::const_iterator it = ref.ints.find(key);
+            CHECK(storage.GetInt(key, -1) == (it != ref.ints.end() ? it->second : -1));
+        }
+        else if (action < 55)
+        {
+            const int defaultValue = getRandom(2) ? 0 : -2;
+            const std::map<ImGuiID, int>::const_iterator it = ref.ints.find(key);
+            int* const ptr = storage.GetIntRef(key, defaultValue);
+            CHECK(*ptr == (it != ref.ints.end() ? it->second : defaultValue));
+            *ptr = value;
+            ref.ints[key] = value;
+        }
+        else if (action < 62)
+        {
+            const std::map<ImGuiID, void*>::const_iterator it = ref.pointers.find(pointerKey);
+            void** const ptr = storage.GetVoidPtrRef(pointerKey, nullptr);
+            CHECK(*ptr == (it != ref.pointers.end() ? it->second : nullptr));
+            *ptr = getPointer(value);
+            ref.pointers[pointerKey] = getPointer(value);
+        }
+        else if (action < 66)
+        {
+            const std::map<ImGuiID, void*>::const_iterator it = ref.pointers.find(pointerKey);
+            CHECK(storage.GetVoidPtr(pointerKey) == (it != ref.pointers.end() ? it->second : nullptr));
+        }
+        else if (action < 68)
+        {
+            storage.BuildSortByKey();
+            for (int i = 1; i < storage.Data.Size; ++i)
+                CHECK(storage.Data[i - 1].key < storage.Data[i].key);
+        }
+        else if (action < 69)
+        {
+            if (getRandom(10) == 0)
+            {
+                storage.Clear();
+                ref.clear();
+            }
+        }
+        else if (action < 72)
+        {
+            // quick full rebuild: new pairs pushed directly, then sorted once
+            for (uint32_t i = 1 + getRandom(20); i > 0; --i)
+            {
+                const ImGuiID newKey = getRandomKey(poolSize * 4);
+                if (ref.ints.count(newKey) == 0)
+                {
+                    storage.Data.push_back(ImGuiStoragePair(newKey, static_cast<int>(i)));
+                    ref.ints[newKey] = i;
+                }
+            }
+            storage.BuildSortByKey();
+        }
+        else if (action < 79)
+        {
+            // direct removal of pairs, lookups must not find the removed ones afterwards
+            if (!storage.Data.empty())
+            {
+                const int index = action < 76 ? storage.Data.Size - 1 : getRandom(storage.Data.Size);
+                ref.erase(storage.Data[index].key);
+                storage.Data.erase(storage.Data.Data + index);
+            }
+        }
+        else if (action < 80)
+        {
+            // same as ImGuiSelectionBasicStorage::Clear()
+            if (getRandom(10) == 0)
+            {
+                storage.Data.resize(0);
+                ref.clear();
+            }
+        }
+        else if (action < 85)
+        {
+            // direct value changes
+            if (!storage.Data.empty())
+            {
+                ImGuiStoragePair& pair = storage.Data[getRandom(storage.Data.Size)];
+                if ((pair.key & kPointerKeyBit) == 0)
+                {
+                    pair.val_i = value;
+                    ref.ints[pair.key] = value;
+                }
+            }
+        }
+        else
+        {
+            // missing keys, mostly
+            const ImGuiID otherKey = key ^ 0x1234u;
+            const std::map<ImGuiID, int>::const_iterator it = ref.ints.find(otherKey);
+            CHECK(storage.GetBool(otherKey, true) == (it == ref.ints.end() || it->second != 0));
+        }
+
+        if (op % 1000 == 999)
+            checkStorage(storage, ref, op);
+    }
+
+    const int op = numOperations;
+    checkStorage(storage, ref, op);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+struct SelectionReference {
+    std::map<ImGuiID, int> order;
+    int nextOrder = 1;
+
+    void clear()
+    {
+        order.clear();
+        nextOrder = 1;
+    }
+};
+
+static void checkSelection(ImGuiSelectionBasicStorage& selection, const SelectionReference& ref, const int op)
+{
+    CHECK(selection.Size == static_cast<int>(ref.order.size()));
+
+    // preserving order sorts storage contents by selection order while iterating, then back by key
+    std::vector<std::pair<int, ImGuiID>> expected;
+    for (const std::pair<const ImGuiID, int>& it : ref.order)
+        expected.push_back(std::make_pair(it.second, it.first));
+    std::sort(expected.begin(), expected.end());
+
+    std::map<ImGuiID, int> found;
+    void* iterator = nullptr;
+    ImGuiID id;
+    size_t index = 0;
+
+    for (; selection.GetNextSelectedItem(&iterator, &id); ++index)
+    {
+        CHECK(found.count(id) == 0);
+        found[id] = 1;
+
+        if (selection.PreserveOrder)
+            CHECK(index < expected.size() && expected[index].second == id);
+    }
+
+    CHECK(found.size() == ref.order.size());
+
+    for (const std::pair<const ImGuiID, int>& it : ref.order)
+        CHECK(selection.Contains(it.first));
+}
+
+static void testSelection(const int numOperations)
+{
+    ImGuiSelectionBasicStorage selections[2];
+    SelectionReference refs[2];
+    uint32_t poolSize = 64;
+
+    for (int op = 0; op < numOperations; ++op)
+    {
+        if (op % 5000 == 0)
+            poolSize = poolSize == 64 ? 2048 : 64;
+
+        ImGuiSelectionBasicStorage& selection(selections[0]);
+        SelectionReference& ref(refs[0]);
+        const uint32_t action = getRandom(100);
+        const ImGuiID id = getRandomKey(poolSize);
+
+        if (action < 40)
+        {
+            const bool selected = getRandom(3) != 0;
+            selection.SetItemSelected(id, selected);
+            if (!selected)
+                ref.order.erase(id);
+            else if (ref.order.count(id) == 0)
+                ref.order[id] = ref.nextOrder++;
+        }
+        else if (action < 80)
+        {
+            CHECK(selection.Contains(id) == (ref.order.count(id) != 0));
+        }
+        else if (action < 81)
+        {
+            if (getRandom(5) == 0)
+            {
+                selection.Clear();
+                ref.clear();
+            }
+        }
+        else if (action < 82)
+        {
+            selection.Swap(selections[1]);
+            std::swap(ref, refs[1]);
+        }
+        else if (action < 87)
+        {
+            selection.PreserveOrder = getRandom(2) != 0;
+            checkSelection(selection, ref, op);
+        }
+        else
+        {
+            CHECK(selection.Contains(id ^ 0x4321u) == (ref.order.count(id ^ 0x4321u) != 0));
+        }
+    }
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+static volatile int gSink = 0;
+
+static double getElapsedNanoseconds(const std::chrono::steady_clock::time_point start, const int count)
+{
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / count;
+}
+
+// insertion of new keys, lookups of existing and missing keys, and toggling like tree nodes do
+static void benchmarkStorage(const int numPairs)
+{
+    static constexpr const int kNumLookups = 2000000;
+
+    std::vector<ImGuiID> keys(numPairs);
+    for (int i = 0; i < numPairs; ++i)
+        keys[i] = ImHashData(&i, sizeof(i), 0x5EED);
+
+    ImGuiStorage storage;
+    int sum = 0;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int i = 0; i < numPairs; ++i)
+        storage.SetInt(keys[i], i);
+    const double insertTime = getElapsedNanoseconds(start, numPairs);
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kNumLookups; ++i)
+        sum += storage.GetInt(keys[i % numPairs], -1);
+    const double lookupTime = getElapsedNanoseconds(start, kNumLookups);
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kNumLookups; ++i)
+        sum += storage.GetInt(keys[i % numPairs] ^ 1, -1);
+    const double missTime = getElapsedNanoseconds(start, kNumLookups);
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kNumLookups; ++i)
+    {
+        bool* const open = storage.GetBoolRef(keys[i % numPairs]);
+        *open = !*open;
+    }
+    const double toggleTime = getElapsedNanoseconds(start, kNumLookups);
+
+    gSink = sum;
+
+   #ifdef IMGUI_DPF_STORAGE_HASH_MAP
+    static constexpr const bool kHashMap = true;
+   #else
+    static constexpr const bool kHashMap = false;
+   #endif
+
+    std::printf("{\"hash_map\":%s,\"pairs\":%d,\"insert_ns\":%.2f,\"lookup_ns\":%.2f,\"miss_ns\":%.2f,\"toggle_ns\":%.2f}\n",
+                kHashMap ? "true" : "false", numPairs, insertTime, lookupTime, missTime, toggleTime);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+
+int main(int argc, char* argv[])
+{
+    const int numOperations = argc > 1 ? std::atoi(argv[1]) : kDefaultNumOperations;
+
+    if (numOperations <= 0)
+    {
+        std::fprintf(stderr, "usage: %s [num-operations]\n", argv[0]);
+        return 1;
+    }
+
+    testStorage(numOperations);
+    testSelection(numOperations / 4);
+
+    if (gNumErrors != 0)
+    {
+        std::fprintf(stderr, "%d checks failed\n", gNumErrors);
+        return 1;
+    }
+
+    for (int numPairs : { 16, 256, 4096, 32768 })
+        benchmarkStorage(numPairs);
+
+    return 0;
+}
+
+// --------------------------------------------------------------------------------------------------------------------